@@ -27,7 +27,7 @@
 */
 
 #include "bluevga.h"
-#include "font.h"
+#include "bluefonts.h"
 #include "bluebitmap.h"      // functions for drawing pixels in the screen using 256 RAM Tiles
 
 // USE_RAM means that we shall use an empty RAM space for 256 tiles of 8x8 pixels
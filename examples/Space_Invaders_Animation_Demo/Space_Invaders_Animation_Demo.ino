@@ -27,7 +27,7 @@
 */
 
 #include "bluevga.h"
-#include "font.h"            // imports an ASCII Flash font bitmap
+#include "bluefonts.h"       // imports the library ASCII Flash font bitmaps
 #include "graph_bitmaps.h"   // bitmap of sprites (invaders, explosions, player, lasers, etc)
 #include "bluebitmap.h"      // functions for drawing bitmaps and sprites in the screen
 
@@ -27,7 +27,7 @@
 */
 
 #include "bluevga.h"
-#include "font.h"            // imports a ASCII Flash font bitmap
+#include "bluefonts.h"       // imports the library ASCII Flash font bitmaps
 #include "bluebitmap.h"      // functions for drawing pixels in the screen
 
 // USE_RAM means that we shall use an empty RAM space for 256 tiles of 8x8 pixels
@@ -1,638 +0,0 @@
-/*
- * 
- * This is one initial font bitmap for 8x8 pixels 
- * Declare here all necessary fonts or any sort of 8x8 drawing
- * In case your sketch does not use it, it will be ignored by the compiler and it will not waste flash
- * 
- */
-
-#ifndef FONT_H
-#define FONT_H
-
-
-/**
- * 8x8 monochrome bitmap fonts for rendering
- * Author: Daniel Hepper <daniel@hepper.net>
- *
- * License: Public Domain
- *
- * Based on:
- * // Summary: font8x8.h
- * // 8x8 monochrome bitmap fonts for rendering
- * //
- * // Author:
- * //     Marcel Sondaar
- * //     International Business Machines (public domain VGA fonts)
- * //
- * // License:
- * //     Public Domain
- *
- * Fetched from: http://dimensionalrift.homelinux.net/combuster/mos3/?p=viewsource&file=/modules/gfx/font8_8.asm
- **/
-
- #include <stdint.h>
- 
-// 1 bpp bitmap - 8x8 tiles for ASCII 0..127 characters, but it can have up to 255 characters, it all depends on the flash space left for it and your sketch!
-const uint8_t ASCII_FONT[128*8] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0000 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0001 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0002 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0003 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0004 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0005 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0006 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0007 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0008 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0009 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+000A (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+000B (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+000C (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+000D (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+000E (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+000F (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0010 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0011 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0012 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0013 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0014 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0015 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0016 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0017 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0018 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0019 (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+001A (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+001B (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+001C (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+001D (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+001E (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+001F (user defined)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0020 (space)
-  0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00,   // U+0021 (!)
-  0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0022 (")
-  0x6C, 0x6C, 0xFE, 0x6C, 0xFE, 0x6C, 0x6C, 0x00,   // U+0023 (#)
-  0x18, 0x3E, 0x60, 0x3C, 0x06, 0x7C, 0x18, 0x00,   // U+0024 ($)
-  0x00, 0xC6, 0xCC, 0x18, 0x30, 0x66, 0xC6, 0x00,   // U+0025 (%)
-  0x38, 0x6C, 0x38, 0x76, 0xDC, 0xCC, 0x76, 0x00,   // U+0026 (&)
-  0x60, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0027 (')
-  0x18, 0x30, 0x60, 0x60, 0x60, 0x30, 0x18, 0x00,   // U+0028 (()
-  0x60, 0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00,   // U+0029 ())
-  0x00, 0x6C, 0x38, 0xFE, 0x38, 0x6C, 0x00, 0x00,   // U+002A (*)
-  0x00, 0x30, 0x30, 0xFC, 0x30, 0x30, 0x00, 0x00,   // U+002B (+)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x60,   // U+002C (,)
-  0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,   // U+002D (-)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,   // U+002E (.)
-  0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00,   // U+002F (/)
-  0x7C, 0xC6, 0xCE, 0xDE, 0xF6, 0xE6, 0x7C, 0x00,   // U+0030 (0)
-  0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0xFC, 0x00,   // U+0031 (1)
-  0x78, 0xCC, 0x0C, 0x38, 0x60, 0xCC, 0xFC, 0x00,   // U+0032 (2)
-  0x78, 0xCC, 0x0C, 0x38, 0x0C, 0xCC, 0x78, 0x00,   // U+0033 (3)
-  0x1C, 0x3C, 0x6C, 0xCC, 0xFE, 0x0C, 0x1E, 0x00,   // U+0034 (4)
-  0xFC, 0xC0, 0xF8, 0x0C, 0x0C, 0xCC, 0x78, 0x00,   // U+0035 (5)
-  0x38, 0x60, 0xC0, 0xF8, 0xCC, 0xCC, 0x78, 0x00,   // U+0036 (6)
-  0xFC, 0xCC, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00,   // U+0037 (7)
-  0x78, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0x78, 0x00,   // U+0038 (8)
-  0x78, 0xCC, 0xCC, 0x7C, 0x0C, 0x18, 0x70, 0x00,   // U+0039 (9)
-  0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00,   // U+003A (:)
-  0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x60,   // U+003B (//)
-  0x18, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x00,   // U+003C (<)
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,   // U+003D (=)
-  0x60, 0x30, 0x18, 0x0C, 0x18, 0x30, 0x60, 0x00,   // U+003E (>)
-  0x78, 0xCC, 0x0C, 0x18, 0x30, 0x00, 0x30, 0x00,   // U+003F (?)
-  0x7C, 0xC6, 0xDE, 0xDE, 0xDE, 0xC0, 0x78, 0x00,   // U+0040 (@)
-  0x30, 0x78, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0x00,   // U+0041 (A)
-  0xFC, 0x66, 0x66, 0x7C, 0x66, 0x66, 0xFC, 0x00,   // U+0042 (B)
-  0x3C, 0x66, 0xC0, 0xC0, 0xC0, 0x66, 0x3C, 0x00,   // U+0043 (C)
-  0xF8, 0x6C, 0x66, 0x66, 0x66, 0x6C, 0xF8, 0x00,   // U+0044 (D)
-  0xFE, 0x62, 0x68, 0x78, 0x68, 0x62, 0xFE, 0x00,   // U+0045 (E)
-  0xFE, 0x62, 0x68, 0x78, 0x68, 0x60, 0xF0, 0x00,   // U+0046 (F)
-  0x3C, 0x66, 0xC0, 0xC0, 0xCE, 0x66, 0x3E, 0x00,   // U+0047 (G)
-  0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0xCC, 0x00,   // U+0048 (H)
-  0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00,   // U+0049 (I)
-  0x1E, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0x78, 0x00,   // U+004A (J)
-  0xE6, 0x66, 0x6C, 0x78, 0x6C, 0x66, 0xE6, 0x00,   // U+004B (K)
-  0xF0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xFE, 0x00,   // U+004C (L)
-  0xC6, 0xEE, 0xFE, 0xFE, 0xD6, 0xC6, 0xC6, 0x00,   // U+004D (M)
-  0xC6, 0xE6, 0xF6, 0xDE, 0xCE, 0xC6, 0xC6, 0x00,   // U+004E (N)
-  0x38, 0x6C, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x00,   // U+004F (O)
-  0xFC, 0x66, 0x66, 0x7C, 0x60, 0x60, 0xF0, 0x00,   // U+0050 (P)
-  0x78, 0xCC, 0xCC, 0xCC, 0xDC, 0x78, 0x1C, 0x00,   // U+0051 (Q)
-  0xFC, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0xE6, 0x00,   // U+0052 (R)
-  0x78, 0xCC, 0xE0, 0x78, 0x1C, 0xCC, 0x78, 0x00,   // U+0053 (S)
-  0xFC, 0xB4, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00,   // U+0054 (T)
-  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0x00,   // U+0055 (U)
-  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x00,   // U+0056 (V)
-  0xC6, 0xC6, 0xC6, 0xD6, 0xFE, 0xEE, 0xC6, 0x00,   // U+0057 (W)
-  0xC6, 0xC6, 0x6C, 0x38, 0x38, 0x6C, 0xC6, 0x00,   // U+0058 (X)
-  0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x30, 0x78, 0x00,   // U+0059 (Y)
-  0xFE, 0xC6, 0x8C, 0x18, 0x32, 0x66, 0xFE, 0x00,   // U+005A (Z)
-  0x78, 0x60, 0x60, 0x60, 0x60, 0x60, 0x78, 0x00,   // U+005B ([)
-  0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x00,   // U+005C (\)
-  0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00,   // U+005D (])
-  0x10, 0x38, 0x6C, 0xC6, 0x00, 0x00, 0x00, 0x00,   // U+005E (^)
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,   // U+005F (_)
-  0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0060 (`)
-  0x00, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0x76, 0x00,   // U+0061 (a)
-  0xE0, 0x60, 0x60, 0x7C, 0x66, 0x66, 0xDC, 0x00,   // U+0062 (b)
-  0x00, 0x00, 0x78, 0xCC, 0xC0, 0xCC, 0x78, 0x00,   // U+0063 (c)
-  0x1C, 0x0C, 0x0C, 0x7C, 0xCC, 0xCC, 0x76, 0x00,   // U+0064 (d)
-  0x00, 0x00, 0x78, 0xCC, 0xFC, 0xC0, 0x78, 0x00,   // U+0065 (e)
-  0x38, 0x6C, 0x60, 0xF0, 0x60, 0x60, 0xF0, 0x00,   // U+0066 (f)
-  0x00, 0x00, 0x76, 0xCC, 0xCC, 0x7C, 0x0C, 0x78,   // U+0067 (g)
-  0xE0, 0x60, 0x6C, 0x76, 0x66, 0x66, 0xE6, 0x00,   // U+0068 (h)
-  0x30, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00,   // U+0069 (i)
-  0x0C, 0x00, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0x78,   // U+006A (j)
-  0xE0, 0x60, 0x66, 0x6C, 0x78, 0x6C, 0xE6, 0x00,   // U+006B (k)
-  0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00,   // U+006C (l)
-  0x00, 0x00, 0xCC, 0xFE, 0xFE, 0xD6, 0xC6, 0x00,   // U+006D (m)
-  0x00, 0x00, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0x00,   // U+006E (n)
-  0x00, 0x00, 0x78, 0xCC, 0xCC, 0xCC, 0x78, 0x00,   // U+006F (o)
-  0x00, 0x00, 0xDC, 0x66, 0x66, 0x7C, 0x60, 0xF0,   // U+0070 (p)
-  0x00, 0x00, 0x76, 0xCC, 0xCC, 0x7C, 0x0C, 0x1E,   // U+0071 (q)
-  0x00, 0x00, 0xDC, 0x76, 0x66, 0x60, 0xF0, 0x00,   // U+0072 (r)
-  0x00, 0x00, 0x7C, 0xC0, 0x78, 0x0C, 0xF8, 0x00,   // U+0073 (s)
-  0x10, 0x30, 0x7C, 0x30, 0x30, 0x34, 0x18, 0x00,   // U+0074 (t)
-  0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00,   // U+0075 (u)
-  0x00, 0x00, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x00,   // U+0076 (v)
-  0x00, 0x00, 0xC6, 0xD6, 0xFE, 0xFE, 0x6C, 0x00,   // U+0077 (w)
-  0x00, 0x00, 0xC6, 0x6C, 0x38, 0x6C, 0xC6, 0x00,   // U+0078 (x)
-  0x00, 0x00, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0xF8,   // U+0079 (y)
-  0x00, 0x00, 0xFC, 0x98, 0x30, 0x64, 0xFC, 0x00,   // U+007A (z)
-  0x1C, 0x30, 0x30, 0xE0, 0x30, 0x30, 0x1C, 0x00,   // U+007B ({)
-  0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00,   // U+007C (|)
-  0xE0, 0x30, 0x30, 0x1C, 0x30, 0x30, 0xE0, 0x00,   // U+007D (})
-  0x00, 0x00, 0x76, 0xDC, 0x00, 0x00, 0x00, 0x00,   // U+007E (~)
-  0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,   // U+007F checkered pattern
-};
-
-//
-// FACE_NAME "IBM CGA 8x8"
-//
-// 0-31,127 : Code page 437, cf. https://en.wikipedia.org/wiki/Code_page_437
-// 32-126   : ASCII
-// 160-255  : ISO-8859-1, cf. https://en.wikipedia.org/wiki/ISO/IEC_8859-1
-
-const uint8_t font8x8_ic8x8u[224*8] = {
-    // ---------------------------  0-127 ---------------------------
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0000 (uni0000.dup1)
-    0x7e, 0x81, 0xa5, 0x81, 0xbd, 0x99, 0x81, 0x7e,  // 0001 (uni0001)
-    0x7e, 0xff, 0xdb, 0xff, 0xc3, 0xe7, 0xff, 0x7e,  // 0002 (uni0002)
-    0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00,  // 0003 (uni0003)
-    0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x00,  // 0004 (uni0004)
-    0x38, 0x7c, 0x38, 0xfe, 0xfe, 0xd6, 0x10, 0x38,  // 0005 (uni0005)
-    0x10, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x10, 0x38,  // 0006 (uni0006)
-    0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00,  // 0007 (uni0007)
-    0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff,  // 0008 (uni0008)
-    0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00,  // 0009 (uni0009)
-    0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff,  // 000a (uni000A)
-    0x0f, 0x07, 0x0f, 0x7d, 0xcc, 0xcc, 0xcc, 0x78,  // 000b (uni000B)
-    0x3c, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x7e, 0x18,  // 000c (uni000C)
-    0x3f, 0x33, 0x3f, 0x30, 0x30, 0x70, 0xf0, 0xe0,  // 000d (uni000D)
-    0x7f, 0x63, 0x7f, 0x63, 0x63, 0x67, 0xe6, 0xc0,  // 000e (uni000E)
-    0x18, 0xdb, 0x3c, 0xe7, 0xe7, 0x3c, 0xdb, 0x18,  // 000f (uni000F)
-    0x80, 0xe0, 0xf8, 0xfe, 0xf8, 0xe0, 0x80, 0x00,  // 0010 (uni0010)
-    0x02, 0x0e, 0x3e, 0xfe, 0x3e, 0x0e, 0x02, 0x00,  // 0011 (uni0011)
-    0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c, 0x18,  // 0012 (uni0012)
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x00,  // 0013 (uni0013)
-    0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00,  // 0014 (uni0014)
-    0x3e, 0x63, 0x38, 0x6c, 0x6c, 0x38, 0xcc, 0x78,  // 0015 (uni0015)
-    0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x00,  // 0016 (uni0016)
-    0x18, 0x3c, 0x7e, 0x18, 0x7e, 0x3c, 0x18, 0xff,  // 0017 (uni0017)
-    0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00,  // 0018 (uni0018)
-    0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00,  // 0019 (uni0019)
-    0x00, 0x18, 0x0c, 0xfe, 0x0c, 0x18, 0x00, 0x00,  // 001a (uni001A)
-    0x00, 0x30, 0x60, 0xfe, 0x60, 0x30, 0x00, 0x00,  // 001b (uni001B)
-    0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xfe, 0x00, 0x00,  // 001c (uni001C)
-    0x00, 0x24, 0x66, 0xff, 0x66, 0x24, 0x00, 0x00,  // 001d (uni001D)
-    0x00, 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x00, 0x00,  // 001e (uni001E)
-    0x00, 0xff, 0xff, 0x7e, 0x3c, 0x18, 0x00, 0x00,  // 001f (uni001F)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0020 (space)
-    0x30, 0x78, 0x78, 0x30, 0x30, 0x00, 0x30, 0x00,  // 0021 (exclam)
-    0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0022 (quotedbl)
-    0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x00,  // 0023 (numbersign)
-    0x30, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x30, 0x00,  // 0024 (dollar)
-    0x00, 0xc6, 0xcc, 0x18, 0x30, 0x66, 0xc6, 0x00,  // 0025 (percent)
-    0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc, 0x76, 0x00,  // 0026 (ampersand)
-    0x60, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0027 (quotesingle)
-    0x18, 0x30, 0x60, 0x60, 0x60, 0x30, 0x18, 0x00,  // 0028 (parenleft)
-    0x60, 0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00,  // 0029 (parenright)
-    0x00, 0x66, 0x3c, 0xff, 0x3c, 0x66, 0x00, 0x00,  // 002a (asterisk)
-    0x00, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x00, 0x00,  // 002b (plus)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x60,  // 002c (comma)
-    0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00,  // 002d (hyphen)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,  // 002e (period)
-    0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x00,  // 002f (slash)
-    0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x7c, 0x00,  // 0030 (zero)
-    0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0xfc, 0x00,  // 0031 (one)
-    0x78, 0xcc, 0x0c, 0x38, 0x60, 0xc4, 0xfc, 0x00,  // 0032 (two)
-    0x78, 0xcc, 0x0c, 0x38, 0x0c, 0xcc, 0x78, 0x00,  // 0033 (three)
-    0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0x0c, 0x1e, 0x00,  // 0034 (four)
-    0xfc, 0xc0, 0xf8, 0x0c, 0x0c, 0xcc, 0x78, 0x00,  // 0035 (five)
-    0x38, 0x60, 0xc0, 0xf8, 0xcc, 0xcc, 0x78, 0x00,  // 0036 (six)
-    0xfc, 0xcc, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x00,  // 0037 (seven)
-    0x78, 0xcc, 0xcc, 0x78, 0xcc, 0xcc, 0x78, 0x00,  // 0038 (eight)
-    0x78, 0xcc, 0xcc, 0x7c, 0x0c, 0x18, 0x70, 0x00,  // 0039 (nine)
-    0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30, 0x00,  // 003a (colon)
-    0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x60, 0x00,  // 003b (semicolon)
-    0x18, 0x30, 0x60, 0xc0, 0x60, 0x30, 0x18, 0x00,  // 003c (less)
-    0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,  // 003d (equal)
-    0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 0x00,  // 003e (greater)
-    0x78, 0xcc, 0x0c, 0x18, 0x30, 0x00, 0x30, 0x00,  // 003f (question)
-    0x7c, 0xc6, 0xde, 0xde, 0xde, 0xc0, 0x78, 0x00,  // 0040 (at)
-    0x30, 0x78, 0xcc, 0xcc, 0xfc, 0xcc, 0xcc, 0x00,  // 0041 (A)
-    0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00,  // 0042 (B)
-    0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x66, 0x3c, 0x00,  // 0043 (C)
-    0xf8, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00,  // 0044 (D)
-    0xfe, 0x62, 0x68, 0x78, 0x68, 0x62, 0xfe, 0x00,  // 0045 (E)
-    0xfe, 0x62, 0x68, 0x78, 0x68, 0x60, 0xf0, 0x00,  // 0046 (F)
-    0x3c, 0x66, 0xc0, 0xc0, 0xce, 0x66, 0x3e, 0x00,  // 0047 (G)
-    0xcc, 0xcc, 0xcc, 0xfc, 0xcc, 0xcc, 0xcc, 0x00,  // 0048 (H)
-    0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00,  // 0049 (I)
-    0x1e, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00,  // 004a (J)
-    0xe6, 0x66, 0x6c, 0x78, 0x6c, 0x66, 0xe6, 0x00,  // 004b (K)
-    0xf0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00,  // 004c (L)
-    0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6, 0x00,  // 004d (M)
-    0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00,  // 004e (N)
-    0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00,  // 004f (O)
-    0xfc, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00,  // 0050 (P)
-    0x78, 0xcc, 0xcc, 0xcc, 0xdc, 0x78, 0x1c, 0x00,  // 0051 (Q)
-    0xfc, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0xe6, 0x00,  // 0052 (R)
-    0x78, 0xcc, 0x60, 0x30, 0x18, 0xcc, 0x78, 0x00,  // 0053 (S)
-    0xfc, 0xb4, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00,  // 0054 (T)
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfc, 0x00,  // 0055 (U)
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x30, 0x00,  // 0056 (V)
-    0xc6, 0xc6, 0xc6, 0xd6, 0xfe, 0xee, 0xc6, 0x00,  // 0057 (W)
-    0xc6, 0xc6, 0x6c, 0x38, 0x38, 0x6c, 0xc6, 0x00,  // 0058 (X)
-    0xcc, 0xcc, 0xcc, 0x78, 0x30, 0x30, 0x78, 0x00,  // 0059 (Y)
-    0xfe, 0xc6, 0x8c, 0x18, 0x32, 0x66, 0xfe, 0x00,  // 005a (Z)
-    0x78, 0x60, 0x60, 0x60, 0x60, 0x60, 0x78, 0x00,  // 005b (bracketleft)
-    0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x00,  // 005c (backslash)
-    0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00,  // 005d (bracketright)
-    0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00,  // 005e (asciicircum)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  // 005f (underscore)
-    0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0060 (grave)
-    0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00,  // 0061 (a)
-    0xe0, 0x60, 0x60, 0x7c, 0x66, 0x66, 0xdc, 0x00,  // 0062 (b)
-    0x00, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x00,  // 0063 (c)
-    0x1c, 0x0c, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00,  // 0064 (d)
-    0x00, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00,  // 0065 (e)
-    0x38, 0x6c, 0x60, 0xf0, 0x60, 0x60, 0xf0, 0x00,  // 0066 (f)
-    0x00, 0x00, 0x76, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8,  // 0067 (g)
-    0xe0, 0x60, 0x6c, 0x76, 0x66, 0x66, 0xe6, 0x00,  // 0068 (h)
-    0x30, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00,  // 0069 (i)
-    0x0c, 0x00, 0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78,  // 006a (j)
-    0xe0, 0x60, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x00,  // 006b (k)
-    0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00,  // 006c (l)
-    0x00, 0x00, 0xcc, 0xfe, 0xfe, 0xd6, 0xc6, 0x00,  // 006d (m)
-    0x00, 0x00, 0xf8, 0xcc, 0xcc, 0xcc, 0xcc, 0x00,  // 006e (n)
-    0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00,  // 006f (o)
-    0x00, 0x00, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0,  // 0070 (p)
-    0x00, 0x00, 0x76, 0xcc, 0xcc, 0x7c, 0x0c, 0x1e,  // 0071 (q)
-    0x00, 0x00, 0xdc, 0x76, 0x66, 0x60, 0xf0, 0x00,  // 0072 (r)
-    0x00, 0x00, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00,  // 0073 (s)
-    0x10, 0x30, 0x7c, 0x30, 0x30, 0x34, 0x18, 0x00,  // 0074 (t)
-    0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00,  // 0075 (u)
-    0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x78, 0x30, 0x00,  // 0076 (v)
-    0x00, 0x00, 0xc6, 0xd6, 0xfe, 0xfe, 0x6c, 0x00,  // 0077 (w)
-    0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00,  // 0078 (x)
-    0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8,  // 0079 (y)
-    0x00, 0x00, 0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00,  // 007a (z)
-    0x1c, 0x30, 0x30, 0xe0, 0x30, 0x30, 0x1c, 0x00,  // 007b (braceleft)
-    0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00,  // 007c (bar)
-    0xe0, 0x30, 0x30, 0x1c, 0x30, 0x30, 0xe0, 0x00,  // 007d (braceright)
-    0x76, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 007e (asciitilde)
-    0x00, 0x10, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0x00,  // 007f (uni007F)
-    // ---------------------------  160-255 ---------------------------
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00a0 (uni00A0)
-    0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00,  // 00a1 (exclamdown)
-    0x18, 0x18, 0x7e, 0xc0, 0xc0, 0x7e, 0x18, 0x18,  // 00a2 (cent)
-    0x38, 0x6c, 0x64, 0xf0, 0x60, 0xe6, 0xfc, 0x00,  // 00a3 (sterling)
-    0x00, 0xc6, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0x00,  // 00a4 (currency)
-    0xcc, 0xcc, 0x78, 0xfc, 0x30, 0xfc, 0x30, 0x30,  // 00a5 (yen)
-    0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00,  // 00a6 (brokenbar)
-    0x3e, 0x63, 0x38, 0x6c, 0x6c, 0x38, 0xcc, 0x78,  // 00a7 (section)
-    0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00a8 (dieresis)
-    0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0x9a, 0x82, 0x7c,  // 00a9 (copyright)
-    0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e, 0x00, 0x00,  // 00aa (ordfeminine)
-    0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00,  // 00ab (guillemotleft)
-    0x00, 0x00, 0x00, 0xfc, 0x0c, 0x0c, 0x00, 0x00,  // 00ac (logicalnot)
-    0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,  // 00ad (uni00AD)
-    0x7c, 0x82, 0xb2, 0xaa, 0xb2, 0xaa, 0x82, 0x7c,  // 00ae (registered)
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00af (macron)
-    0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00,  // 00b0 (degree)
-    0x30, 0x30, 0xfc, 0x30, 0x30, 0x00, 0xfc, 0x00,  // 00b1 (plusminus)
-    0x70, 0x18, 0x30, 0x60, 0x78, 0x00, 0x00, 0x00,  // 00b2 (uni00B2)
-    0x70, 0x18, 0x30, 0x18, 0x70, 0x00, 0x00, 0x00,  // 00b3 (uni00B3)
-    0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00b4 (acute)
-    0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0xc0,  // 00b5 (mu)
-    0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00,  // 00b6 (paragraph)
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,  // 00b7 (periodcentered)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0c, 0x38,  // 00b8 (cedilla)
-    0x30, 0x70, 0x30, 0x30, 0x78, 0x00, 0x00, 0x00,  // 00b9 (uni00B9)
-    0x38, 0x6c, 0x6c, 0x38, 0x00, 0x7c, 0x00, 0x00,  // 00ba (ordmasculine)
-    0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00,  // 00bb (guillemotright)
-    0xc3, 0xc6, 0xcc, 0xdb, 0x37, 0x6f, 0xcf, 0x03,  // 00bc (onequarter)
-    0xc3, 0xc6, 0xcc, 0xde, 0x33, 0x66, 0xcc, 0x0f,  // 00bd (onehalf)
-    0xe0, 0x33, 0x66, 0x3c, 0xfb, 0x37, 0x6f, 0xc3,  // 00be (threequarters)
-    0x30, 0x00, 0x30, 0x60, 0xc0, 0xcc, 0x78, 0x00,  // 00bf (questiondown)
-    0xc0, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00,  // 00c0 (Agrave)
-    0x06, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00,  // 00c1 (Aacute)
-    0x78, 0xcc, 0x00, 0x78, 0xcc, 0xfc, 0xcc, 0x00,  // 00c2 (Acircumflex)
-    0xfc, 0x00, 0x78, 0xcc, 0xfc, 0xcc, 0xcc, 0x00,  // 00c3 (Atilde)
-    0xc6, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0xc6, 0x00,  // 00c4 (Adieresis)
-    0x30, 0x30, 0x00, 0x78, 0xcc, 0xfc, 0xcc, 0x00,  // 00c5 (Aring)
-    0x3e, 0x6c, 0xcc, 0xfe, 0xcc, 0xcc, 0xce, 0x00,  // 00c6 (AE)
-    0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x18, 0x0c, 0x78,  // 00c7 (Ccedilla)
-    0xe0, 0x00, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00,  // 00c8 (Egrave)
-    0x1c, 0x00, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00,  // 00c9 (Eacute)
-    0x78, 0xcc, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00,  // 00ca (Ecircumflex)
-    0xcc, 0x00, 0xfc, 0x60, 0x78, 0x60, 0xfc, 0x00,  // 00cb (Edieresis)
-    0xe0, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00,  // 00cc (Igrave)
-    0x1c, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00,  // 00cd (Iacute)
-    0x78, 0xcc, 0x00, 0x78, 0x30, 0x30, 0x78, 0x00,  // 00ce (Icircumflex)
-    0xcc, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00,  // 00cf (Idieresis)
-    0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00,  // 00d0 (Eth)
-    0xfc, 0x00, 0xcc, 0xec, 0xfc, 0xdc, 0xcc, 0x00,  // 00d1 (Ntilde)
-    0xc0, 0x18, 0x3c, 0x66, 0x66, 0x3c, 0x18, 0x00,  // 00d2 (Ograve)
-    0x06, 0x30, 0x78, 0xcc, 0xcc, 0x78, 0x30, 0x00,  // 00d3 (Oacute)
-    0x7c, 0xc6, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00,  // 00d4 (Ocircumflex)
-    0xfe, 0x00, 0x38, 0x6c, 0xc6, 0x6c, 0x38, 0x00,  // 00d5 (Otilde)
-    0xc3, 0x18, 0x3c, 0x66, 0x66, 0x3c, 0x18, 0x00,  // 00d6 (Odieresis)
-    0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0x00, 0x00,  // 00d7 (multiply)
-    0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x7c, 0x00,  // 00d8 (Oslash)
-    0xe0, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00,  // 00d9 (Ugrave)
-    0x1c, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00,  // 00da (Uacute)
-    0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x78, 0x00,  // 00db (Ucircumflex)
-    0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x78, 0x00,  // 00dc (Udieresis)
-    0x1c, 0x00, 0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00,  // 00dd (Yacute)
-    0xf0, 0x60, 0x7c, 0x66, 0x7c, 0x60, 0xf0, 0x00,  // 00de (Thorn)
-    0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6, 0xcc, 0x00,  // 00df (germandbls)
-    0xe0, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00,  // 00e0 (agrave)
-    0x1c, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00,  // 00e1 (aacute)
-    0x7e, 0xc3, 0x3c, 0x06, 0x3e, 0x66, 0x3f, 0x00,  // 00e2 (acircumflex)
-    0xfc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00,  // 00e3 (atilde)
-    0xcc, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00,  // 00e4 (adieresis)
-    0x30, 0x30, 0x78, 0x0c, 0x7c, 0xcc, 0x7e, 0x00,  // 00e5 (aring)
-    0x00, 0x00, 0x7f, 0x0c, 0x7f, 0xcc, 0x7f, 0x00,  // 00e6 (ae)
-    0x00, 0x00, 0x78, 0xc0, 0xc0, 0x78, 0x0c, 0x38,  // 00e7 (ccedilla)
-    0xe0, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00,  // 00e8 (egrave)
-    0x1c, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00,  // 00e9 (eacute)
-    0x7e, 0xc3, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00,  // 00ea (ecircumflex)
-    0xcc, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00,  // 00eb (edieresis)
-    0xe0, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00,  // 00ec (igrave)
-    0x38, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00,  // 00ed (iacute)
-    0x7c, 0xc6, 0x38, 0x18, 0x18, 0x18, 0x3c, 0x00,  // 00ee (icircumflex)
-    0xcc, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00,  // 00ef (idieresis)
-    0x18, 0x3e, 0x0c, 0x7c, 0xcc, 0xcc, 0x78, 0x00,  // 00f0 (eth)
-    0x00, 0xf8, 0x00, 0xf8, 0xcc, 0xcc, 0xcc, 0x00,  // 00f1 (ntilde)
-    0x00, 0xe0, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00,  // 00f2 (ograve)
-    0x00, 0x1c, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00,  // 00f3 (oacute)
-    0x78, 0xcc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00,  // 00f4 (ocircumflex)
-    0x00, 0xfc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00,  // 00f5 (otilde)
-    0x00, 0xcc, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00,  // 00f6 (odieresis)
-    0x30, 0x30, 0x00, 0xfc, 0x00, 0x30, 0x30, 0x00,  // 00f7 (divide)
-    0x00, 0x02, 0x7c, 0xce, 0xd6, 0xe6, 0x7c, 0x80,  // 00f8 (oslash)
-    0x00, 0xe0, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00,  // 00f9 (ugrave)
-    0x00, 0x1c, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00,  // 00fa (uacute)
-    0x78, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00,  // 00fb (ucircumflex)
-    0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7e, 0x00,  // 00fc (udieresis)
-    0x00, 0x1c, 0x00, 0xcc, 0xcc, 0x7c, 0x0c, 0x78,  // 00fd (yacute)
-    0xe0, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xf0,  // 00fe (thorn)
-    0x00, 0xcc, 0x00, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8,  // 00ff (ydieresis)
-};
-
-//
-// FACE_NAME "IBM CGA Light 8x8"
-//
-// 0-31,127 : Code page 437, cf. https://en.wikipedia.org/wiki/Code_page_437
-// 32-126   : ASCII
-// 160-255  : ISO-8859-1, cf. https://en.wikipedia.org/wiki/ISO/IEC_8859-1
-
-const uint8_t font8x8_icl8x8u[224*8] = {
-    // ---------------------------  0-127 ---------------------------
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0000 (uni0000.dup1)
-    0x7e, 0x81, 0xa5, 0x81, 0xbd, 0x99, 0x81, 0x7e,  // 0001 (uni0001)
-    0x7e, 0xff, 0xdb, 0xff, 0xc3, 0xe7, 0xff, 0x7e,  // 0002 (uni0002)
-    0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00,  // 0003 (uni0003)
-    0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x00,  // 0004 (uni0004)
-    0x38, 0x7c, 0x38, 0xfe, 0xfe, 0xd6, 0x10, 0x38,  // 0005 (uni0005)
-    0x10, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x10, 0x38,  // 0006 (uni0006)
-    0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00,  // 0007 (uni0007)
-    0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff,  // 0008 (uni0008)
-    0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00,  // 0009 (uni0009)
-    0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff,  // 000a (uni000A)
-    0x0f, 0x03, 0x05, 0x7d, 0x84, 0x84, 0x84, 0x78,  // 000b (uni000B)
-    0x3c, 0x42, 0x42, 0x42, 0x3c, 0x18, 0x7e, 0x18,  // 000c (uni000C)
-    0x3f, 0x21, 0x3f, 0x20, 0x20, 0x60, 0xe0, 0xc0,  // 000d (uni000D)
-    0x3f, 0x21, 0x3f, 0x21, 0x23, 0x67, 0xe6, 0xc0,  // 000e (uni000E)
-    0x18, 0xdb, 0x3c, 0xe7, 0xe7, 0x3c, 0xdb, 0x18,  // 000f (uni000F)
-    0x80, 0xe0, 0xf8, 0xfe, 0xf8, 0xe0, 0x80, 0x00,  // 0010 (uni0010)
-    0x02, 0x0e, 0x3e, 0xfe, 0x3e, 0x0e, 0x02, 0x00,  // 0011 (uni0011)
-    0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c, 0x18,  // 0012 (uni0012)
-    0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x00,  // 0013 (uni0013)
-    0x7f, 0x92, 0x92, 0x72, 0x12, 0x12, 0x12, 0x00,  // 0014 (uni0014)
-    0x3e, 0x63, 0x38, 0x44, 0x44, 0x38, 0xcc, 0x78,  // 0015 (uni0015)
-    0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x00,  // 0016 (uni0016)
-    0x18, 0x3c, 0x7e, 0x18, 0x7e, 0x3c, 0x18, 0xff,  // 0017 (uni0017)
-    0x10, 0x38, 0x7c, 0x54, 0x10, 0x10, 0x10, 0x00,  // 0018 (uni0018)
-    0x10, 0x10, 0x10, 0x54, 0x7c, 0x38, 0x10, 0x00,  // 0019 (uni0019)
-    0x00, 0x18, 0x0c, 0xfe, 0x0c, 0x18, 0x00, 0x00,  // 001a (uni001A)
-    0x00, 0x30, 0x60, 0xfe, 0x60, 0x30, 0x00, 0x00,  // 001b (uni001B)
-    0x00, 0x00, 0x40, 0x40, 0x40, 0x7e, 0x00, 0x00,  // 001c (uni001C)
-    0x00, 0x24, 0x66, 0xff, 0x66, 0x24, 0x00, 0x00,  // 001d (uni001D)
-    0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x00, 0x00,  // 001e (uni001E)
-    0x00, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00,  // 001f (uni001F)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0020 (space)
-    0x10, 0x38, 0x38, 0x10, 0x10, 0x00, 0x10, 0x00,  // 0021 (exclam)
-    0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0022 (quotedbl)
-    0x24, 0x24, 0x7e, 0x24, 0x7e, 0x24, 0x24, 0x00,  // 0023 (numbersign)
-    0x18, 0x3e, 0x40, 0x3c, 0x02, 0x7c, 0x18, 0x00,  // 0024 (dollar)
-    0x00, 0x62, 0x64, 0x08, 0x10, 0x26, 0x46, 0x00,  // 0025 (percent)
-    0x30, 0x48, 0x30, 0x56, 0x88, 0x88, 0x76, 0x00,  // 0026 (ampersand)
-    0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0027 (quotesingle)
-    0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00,  // 0028 (parenleft)
-    0x20, 0x10, 0x08, 0x08, 0x08, 0x10, 0x20, 0x00,  // 0029 (parenright)
-    0x00, 0x44, 0x38, 0xfe, 0x38, 0x44, 0x00, 0x00,  // 002a (asterisk)
-    0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00,  // 002b (plus)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x20,  // 002c (comma)
-    0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,  // 002d (hyphen)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00,  // 002e (period)
-    0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00,  // 002f (slash)
-    0x3c, 0x42, 0x46, 0x4a, 0x52, 0x62, 0x3c, 0x00,  // 0030 (zero)
-    0x10, 0x30, 0x50, 0x10, 0x10, 0x10, 0x7c, 0x00,  // 0031 (one)
-    0x3c, 0x42, 0x02, 0x0c, 0x30, 0x42, 0x7e, 0x00,  // 0032 (two)
-    0x3c, 0x42, 0x02, 0x1c, 0x02, 0x42, 0x3c, 0x00,  // 0033 (three)
-    0x08, 0x18, 0x28, 0x48, 0xfe, 0x08, 0x1c, 0x00,  // 0034 (four)
-    0x7e, 0x40, 0x7c, 0x02, 0x02, 0x42, 0x3c, 0x00,  // 0035 (five)
-    0x1c, 0x20, 0x40, 0x7c, 0x42, 0x42, 0x3c, 0x00,  // 0036 (six)
-    0x7e, 0x42, 0x04, 0x08, 0x10, 0x10, 0x10, 0x00,  // 0037 (seven)
-    0x3c, 0x42, 0x42, 0x3c, 0x42, 0x42, 0x3c, 0x00,  // 0038 (eight)
-    0x3c, 0x42, 0x42, 0x3e, 0x02, 0x04, 0x38, 0x00,  // 0039 (nine)
-    0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00,  // 003a (colon)
-    0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x20,  // 003b (semicolon)
-    0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00,  // 003c (less)
-    0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00,  // 003d (equal)
-    0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00,  // 003e (greater)
-    0x3c, 0x42, 0x02, 0x04, 0x08, 0x00, 0x08, 0x00,  // 003f (question)
-    0x3c, 0x42, 0x5e, 0x52, 0x5e, 0x40, 0x3c, 0x00,  // 0040 (at)
-    0x18, 0x24, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x00,  // 0041 (A)
-    0x7c, 0x22, 0x22, 0x3c, 0x22, 0x22, 0x7c, 0x00,  // 0042 (B)
-    0x1c, 0x22, 0x40, 0x40, 0x40, 0x22, 0x1c, 0x00,  // 0043 (C)
-    0x78, 0x24, 0x22, 0x22, 0x22, 0x24, 0x78, 0x00,  // 0044 (D)
-    0x7e, 0x22, 0x28, 0x38, 0x28, 0x22, 0x7e, 0x00,  // 0045 (E)
-    0x7e, 0x22, 0x28, 0x38, 0x28, 0x20, 0x70, 0x00,  // 0046 (F)
-    0x1c, 0x22, 0x40, 0x40, 0x4e, 0x22, 0x1e, 0x00,  // 0047 (G)
-    0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42, 0x00,  // 0048 (H)
-    0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00,  // 0049 (I)
-    0x0e, 0x04, 0x04, 0x04, 0x44, 0x44, 0x38, 0x00,  // 004a (J)
-    0x62, 0x24, 0x28, 0x30, 0x28, 0x24, 0x63, 0x00,  // 004b (K)
-    0x70, 0x20, 0x20, 0x20, 0x20, 0x22, 0x7e, 0x00,  // 004c (L)
-    0x63, 0x55, 0x49, 0x41, 0x41, 0x41, 0x41, 0x00,  // 004d (M)
-    0x62, 0x52, 0x4a, 0x46, 0x42, 0x42, 0x42, 0x00,  // 004e (N)
-    0x18, 0x24, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00,  // 004f (O)
-    0x7c, 0x22, 0x22, 0x3c, 0x20, 0x20, 0x70, 0x00,  // 0050 (P)
-    0x3c, 0x42, 0x42, 0x42, 0x4a, 0x3c, 0x03, 0x00,  // 0051 (Q)
-    0x7c, 0x22, 0x22, 0x3c, 0x28, 0x24, 0x72, 0x00,  // 0052 (R)
-    0x3c, 0x42, 0x40, 0x3c, 0x02, 0x42, 0x3c, 0x00,  // 0053 (S)
-    0x7f, 0x49, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00,  // 0054 (T)
-    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 0055 (U)
-    0x41, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x00,  // 0056 (V)
-    0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x36, 0x00,  // 0057 (W)
-    0x41, 0x22, 0x14, 0x08, 0x14, 0x22, 0x41, 0x00,  // 0058 (X)
-    0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x1c, 0x00,  // 0059 (Y)
-    0x7f, 0x42, 0x04, 0x08, 0x10, 0x21, 0x7f, 0x00,  // 005a (Z)
-    0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00,  // 005b (bracketleft)
-    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00,  // 005c (backslash)
-    0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00,  // 005d (bracketright)
-    0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x00,  // 005e (asciicircum)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  // 005f (underscore)
-    0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0060 (grave)
-    0x00, 0x00, 0x3c, 0x02, 0x3e, 0x42, 0x3f, 0x00,  // 0061 (a)
-    0x60, 0x20, 0x20, 0x2e, 0x31, 0x31, 0x2e, 0x00,  // 0062 (b)
-    0x00, 0x00, 0x3c, 0x42, 0x40, 0x42, 0x3c, 0x00,  // 0063 (c)
-    0x06, 0x02, 0x02, 0x3a, 0x46, 0x46, 0x3b, 0x00,  // 0064 (d)
-    0x00, 0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00,  // 0065 (e)
-    0x0c, 0x12, 0x10, 0x38, 0x10, 0x10, 0x38, 0x00,  // 0066 (f)
-    0x00, 0x00, 0x3d, 0x42, 0x42, 0x3e, 0x02, 0x7c,  // 0067 (g)
-    0x60, 0x20, 0x2c, 0x32, 0x22, 0x22, 0x62, 0x00,  // 0068 (h)
-    0x10, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,  // 0069 (i)
-    0x02, 0x00, 0x06, 0x02, 0x02, 0x42, 0x42, 0x3c,  // 006a (j)
-    0x60, 0x20, 0x24, 0x28, 0x30, 0x28, 0x26, 0x00,  // 006b (k)
-    0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00,  // 006c (l)
-    0x00, 0x00, 0x76, 0x49, 0x49, 0x49, 0x49, 0x00,  // 006d (m)
-    0x00, 0x00, 0x5c, 0x62, 0x42, 0x42, 0x42, 0x00,  // 006e (n)
-    0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 006f (o)
-    0x00, 0x00, 0x6c, 0x32, 0x32, 0x2c, 0x20, 0x70,  // 0070 (p)
-    0x00, 0x00, 0x36, 0x4c, 0x4c, 0x34, 0x04, 0x0e,  // 0071 (q)
-    0x00, 0x00, 0x6c, 0x32, 0x22, 0x20, 0x70, 0x00,  // 0072 (r)
-    0x00, 0x00, 0x3e, 0x40, 0x3c, 0x02, 0x7c, 0x00,  // 0073 (s)
-    0x10, 0x10, 0x7c, 0x10, 0x10, 0x12, 0x0c, 0x00,  // 0074 (t)
-    0x00, 0x00, 0x42, 0x42, 0x42, 0x46, 0x3a, 0x00,  // 0075 (u)
-    0x00, 0x00, 0x41, 0x41, 0x22, 0x14, 0x08, 0x00,  // 0076 (v)
-    0x00, 0x00, 0x41, 0x49, 0x49, 0x49, 0x36, 0x00,  // 0077 (w)
-    0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00,  // 0078 (x)
-    0x00, 0x00, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x7c,  // 0079 (y)
-    0x00, 0x00, 0x7c, 0x08, 0x10, 0x20, 0x7c, 0x00,  // 007a (z)
-    0x0c, 0x10, 0x10, 0x60, 0x10, 0x10, 0x0c, 0x00,  // 007b (braceleft)
-    0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00,  // 007c (bar)
-    0x30, 0x08, 0x08, 0x06, 0x08, 0x08, 0x30, 0x00,  // 007d (braceright)
-    0x32, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 007e (asciitilde)
-    0x00, 0x08, 0x14, 0x22, 0x41, 0x41, 0x7f, 0x00,  // 007f (uni007F)
-    // ---------------------------  160-255 ---------------------------
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00a0 (uni00A0)
-    0x00, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x00,  // 00a1 (exclamdown)
-    0x08, 0x08, 0x3e, 0x40, 0x40, 0x3e, 0x08, 0x08,  // 00a2 (cent)
-    0x18, 0x24, 0x20, 0x70, 0x20, 0x42, 0x7c, 0x00,  // 00a3 (sterling)
-    0x00, 0xc6, 0x38, 0x44, 0x44, 0x38, 0xc6, 0x00,  // 00a4 (currency)
-    0x44, 0x28, 0x7c, 0x10, 0x7c, 0x10, 0x10, 0x00,  // 00a5 (yen)
-    0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00,  // 00a6 (brokenbar)
-    0x3e, 0x63, 0x38, 0x44, 0x44, 0x38, 0xcc, 0x78,  // 00a7 (section)
-    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00a8 (dieresis)
-    0x7c, 0x82, 0x9a, 0xa2, 0xa2, 0x9a, 0x82, 0x7c,  // 00a9 (copyright)
-    0x3c, 0x44, 0x44, 0x3e, 0x00, 0x7e, 0x00, 0x00,  // 00aa (ordfeminine)
-    0x00, 0x12, 0x24, 0x48, 0x24, 0x12, 0x00, 0x00,  // 00ab (guillemotleft)
-    0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x00, 0x00,  // 00ac (logicalnot)
-    0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,  // 00ad (uni00AD)
-    0x7c, 0x82, 0xb2, 0xaa, 0xb2, 0xaa, 0x82, 0x7c,  // 00ae (registered)
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00af (macron)
-    0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00,  // 00b0 (degree)
-    0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x7c, 0x00,  // 00b1 (plusminus)
-    0x30, 0x48, 0x10, 0x20, 0x78, 0x00, 0x00, 0x00,  // 00b2 (uni00B2)
-    0x30, 0x48, 0x10, 0x48, 0x30, 0x00, 0x00, 0x00,  // 00b3 (uni00B3)
-    0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 00b4 (acute)
-    0x00, 0x44, 0x44, 0x44, 0x7a, 0x40, 0x40, 0x80,  // 00b5 (mu)
-    0x7f, 0x92, 0x92, 0x72, 0x12, 0x12, 0x12, 0x00,  // 00b6 (paragraph)
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,  // 00b7 (periodcentered)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x38,  // 00b8 (cedilla)
-    0x20, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00,  // 00b9 (uni00B9)
-    0x38, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x00, 0x00,  // 00ba (ordmasculine)
-    0x00, 0x48, 0x24, 0x12, 0x24, 0x48, 0x00, 0x00,  // 00bb (guillemotright)
-    0x42, 0xc4, 0x4a, 0xf6, 0x2a, 0x5f, 0x82, 0x02,  // 00bc (onequarter)
-    0x42, 0xc4, 0x48, 0xf6, 0x29, 0x43, 0x8c, 0x1f,  // 00bd (onehalf)
-    0xc0, 0x22, 0xc4, 0x2a, 0xd6, 0x2a, 0x5f, 0x82,  // 00be (threequarters)
-    0x10, 0x00, 0x10, 0x20, 0x40, 0x42, 0x3c, 0x00,  // 00bf (questiondown)
-    0xc0, 0x18, 0x24, 0x42, 0x7e, 0x42, 0x42, 0x00,  // 00c0 (Agrave)
-    0x03, 0x18, 0x24, 0x42, 0x7e, 0x42, 0x42, 0x00,  // 00c1 (Aacute)
-    0x3c, 0x42, 0x18, 0x24, 0x42, 0x7e, 0x42, 0x00,  // 00c2 (Acircumflex)
-    0x7e, 0x00, 0x3c, 0x42, 0x7e, 0x42, 0x42, 0x00,  // 00c3 (Atilde)
-    0x42, 0x18, 0x24, 0x42, 0x7e, 0x42, 0x42, 0x00,  // 00c4 (Adieresis)
-    0x18, 0x18, 0x00, 0x3c, 0x42, 0x7e, 0x42, 0x00,  // 00c5 (Aring)
-    0x1f, 0x24, 0x44, 0x7f, 0x44, 0x44, 0x47, 0x00,  // 00c6 (AE)
-    0x3c, 0x42, 0x40, 0x42, 0x3c, 0x0c, 0x02, 0x3c,  // 00c7 (Ccedilla)
-    0x60, 0x00, 0x7c, 0x20, 0x38, 0x20, 0x7c, 0x00,  // 00c8 (Egrave)
-    0x0c, 0x00, 0x7c, 0x20, 0x38, 0x20, 0x7c, 0x00,  // 00c9 (Eacute)
-    0x7c, 0x82, 0x7c, 0x20, 0x38, 0x20, 0x7c, 0x00,  // 00ca (Ecircumflex)
-    0x44, 0x00, 0x7c, 0x20, 0x38, 0x20, 0x7c, 0x00,  // 00cb (Edieresis)
-    0x60, 0x00, 0x38, 0x10, 0x10, 0x10, 0x38, 0x00,  // 00cc (Igrave)
-    0x0c, 0x00, 0x38, 0x10, 0x10, 0x10, 0x38, 0x00,  // 00cd (Iacute)
-    0x7c, 0x82, 0x38, 0x10, 0x10, 0x10, 0x38, 0x00,  // 00ce (Icircumflex)
-    0x44, 0x00, 0x38, 0x10, 0x10, 0x10, 0x38, 0x00,  // 00cf (Idieresis)
-    0x78, 0x24, 0x22, 0x72, 0x22, 0x24, 0x78, 0x00,  // 00d0 (Eth)
-    0x34, 0x4c, 0x00, 0x62, 0x52, 0x4a, 0x46, 0x00,  // 00d1 (Ntilde)
-    0xc0, 0x18, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00,  // 00d2 (Ograve)
-    0x03, 0x18, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00,  // 00d3 (Oacute)
-    0x7c, 0x82, 0x38, 0x44, 0x82, 0x44, 0x38, 0x00,  // 00d4 (Ocircumflex)
-    0x7f, 0x00, 0x1c, 0x22, 0x41, 0x22, 0x1c, 0x00,  // 00d5 (Otilde)
-    0x42, 0x18, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00,  // 00d6 (Odieresis)
-    0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00,  // 00d7 (multiply)
-    0x7c, 0x86, 0x8e, 0xba, 0xe2, 0xc2, 0x7c, 0x00,  // 00d8 (Oslash)
-    0x60, 0x00, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 00d9 (Ugrave)
-    0x06, 0x00, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 00da (Uacute)
-    0x3c, 0x42, 0x00, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 00db (Ucircumflex)
-    0x42, 0x00, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 00dc (Udieresis)
-    0x06, 0x00, 0x44, 0x28, 0x10, 0x10, 0x38, 0x00,  // 00dd (Yacute)
-    0x70, 0x20, 0x3c, 0x22, 0x3c, 0x20, 0x70, 0x00,  // 00de (Thorn)
-    0x38, 0x44, 0x44, 0x48, 0x44, 0x42, 0x4c, 0x00,  // 00df (germandbls)
-    0x30, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00,  // 00e0 (agrave)
-    0x0c, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00,  // 00e1 (aacute)
-    0x3c, 0x42, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00,  // 00e2 (acircumflex)
-    0x7e, 0x00, 0x3c, 0x02, 0x3e, 0x42, 0x3f, 0x00,  // 00e3 (atilde)
-    0x42, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00,  // 00e4 (adieresis)
-    0x10, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00,  // 00e5 (aring)
-    0x00, 0x00, 0x33, 0x0c, 0x3f, 0x4c, 0x3b, 0x00,  // 00e6 (ae)
-    0x00, 0x00, 0x3c, 0x40, 0x40, 0x3c, 0x06, 0x1c,  // 00e7 (ccedilla)
-    0x30, 0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00,  // 00e8 (egrave)
-    0x0c, 0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00,  // 00e9 (eacute)
-    0x3c, 0x42, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00,  // 00ea (ecircumflex)
-    0x42, 0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00,  // 00eb (edieresis)
-    0x30, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1c, 0x00,  // 00ec (igrave)
-    0x0c, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1c, 0x00,  // 00ed (iacute)
-    0x78, 0x84, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,  // 00ee (icircumflex)
-    0x24, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1c, 0x00,  // 00ef (idieresis)
-    0x08, 0x3e, 0x04, 0x3c, 0x44, 0x44, 0x38, 0x00,  // 00f0 (eth)
-    0x32, 0x4c, 0x00, 0x7c, 0x42, 0x42, 0x42, 0x00,  // 00f1 (ntilde)
-    0x20, 0x10, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00,  // 00f2 (ograve)
-    0x04, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00,  // 00f3 (oacute)
-    0x18, 0x24, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00,  // 00f4 (ocircumflex)
-    0x00, 0x7e, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00,  // 00f5 (otilde)
-    0x00, 0x42, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00,  // 00f6 (odieresis)
-    0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00,  // 00f7 (divide)
-    0x00, 0x02, 0x7c, 0x8a, 0x92, 0xa2, 0x7c, 0x80,  // 00f8 (oslash)
-    0x20, 0x10, 0x00, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 00f9 (ugrave)
-    0x00, 0x04, 0x08, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 00fa (uacute)
-    0x18, 0x24, 0x00, 0x42, 0x42, 0x42, 0x3c, 0x00,  // 00fb (ucircumflex)
-    0x00, 0x44, 0x00, 0x44, 0x44, 0x44, 0x3e, 0x00,  // 00fc (udieresis)
-    0x00, 0x06, 0x00, 0x42, 0x42, 0x3e, 0x02, 0x3c,  // 00fd (yacute)
-    0x60, 0x20, 0x3c, 0x22, 0x22, 0x3c, 0x20, 0x70,  // 00fe (thorn)
-    0x00, 0x42, 0x00, 0x42, 0x42, 0x3e, 0x02, 0x3c,  // 00ff (ydieresis)
-};
-#endif
@@ -27,7 +27,7 @@
 */
 
 #include "bluevga.h"
-#include "font.h"
+#include "bluefonts.h"
 #include "Joystick.h"
 
 // using an Arduino Analog Joystick - VRX Analog Signal on PB0, VRY Analog Signal on PB1 and SW on PB10
@@ -36,11 +36,11 @@ Joystick joystick(PB0, PB0, PB1, PB1, PB10);
 
 
 // creates a BlueVGA object using ASCII_FONT as bitmap for all the tiles (ASCII characters)
-BlueVGA vga(ASCII_FONT);
+// the screen starts filled with ASCII 0x20 (blank space), black foreground over black background - no need to clear it in setup()
+BlueVGA vga(ASCII_FONT, RGB_BLACK | RGB_BLACK << 4, ' ');
 
 void setup() {
   // draws the inital screen
-  vga.clearScreen();     // ASCII 0x20 (blank space) is, by default, used to fill the whole screen. Here we set background color to black, and also black for foreground!
   vga.printStr(1, 2, vga.getColorCode(RGB_YELLOW, RGB_BLACK), (char *)"Move the Joystick & watch");
   vga.printStr(1, 3, vga.getColorCode(RGB_YELLOW, RGB_BLACK), (char *)"watch analogRead changes!");
   vga.printStr(1, 7, vga.getColorCode(RGB_WHITE, RGB_BLACK), (char *)"Analog Value of VRX: 000");
@@ -27,7 +27,7 @@
 */
 
 #include "bluevga.h"
-#include "font.h"
+#include "bluefonts.h"
 
 // creates a BlueVGA object using ASCII_FONT as bitmap for all the tiles
 BlueVGA vga(ASCII_FONT);
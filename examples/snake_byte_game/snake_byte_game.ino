@@ -159,8 +159,9 @@ void runGame(int32_t &score, int32_t &hiscore) {
   // runs the game while player doesn't get killed
   while (!dead) {
     vga.waitVSync(); // holds up to the start of next frame - it keeps the screen solid and clean
+    uint8_t pad = joystick.poll(); // reads all joystick inputs once per frame
 
-    if (joystick.firePressed()) break; // player may want to quit by pressing joystick switch...
+    if (pad & JOY_FIRE) break; // player may want to quit by pressing joystick switch...
 
     if (!numBeetles && !numFlies) {  // wave finished? then restart it and speed up the game!
       populateScr(10);
@@ -171,22 +172,22 @@ void runGame(int32_t &score, int32_t &hiscore) {
     }
 
     // check the joystick... but no move is done until right time...
-    if (joystick.rightPressed()) {
+    if (pad & JOY_RIGHT) {
       dx = 1;
       dy = 0;
       vga.setTile(headPosX, headPosY, SNK_HD_RT_TILE, SNK_HEAD_COLOR);
     }
-    else if (joystick.leftPressed()) {
+    else if (pad & JOY_LEFT) {
       dx = -1;
       dy = 0;
       vga.setTile(headPosX, headPosY, SNK_HD_LT_TILE, SNK_HEAD_COLOR);
     }
-    else if (joystick.downPressed()) {
+    else if (pad & JOY_DOWN) {
       dx = 0;
       dy = 1;
       vga.setTile(headPosX, headPosY, SNK_HD_DW_TILE, SNK_HEAD_COLOR);
     }
-    else if (joystick.upPressed()) {
+    else if (pad & JOY_UP) {
       dx = 0;
       dy = -1;
       vga.setTile(headPosX, headPosY, SNK_HD_UP_TILE, SNK_HEAD_COLOR);
@@ -0,0 +1,112 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include "InputDevice.h"
+
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+#include <libmaple/gpio.h>
+
+#define GPIOA_REG  GPIOA_BASE
+#define GPIOB_REG  GPIOB_BASE
+#define GPIOC_REG  GPIOC_BASE
+#endif
+
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+#define GPIOA_REG  GPIOA
+#define GPIOB_REG  GPIOB
+#define GPIOC_REG  GPIOC
+#endif
+
+
+// cast as libmaple registers are uint32 (unsigned int), not uint32_t (unsigned long)
+volatile uint32_t * const InputDevice::gpioIDR[INPUT_GPIO_PORTS] = {
+  (volatile uint32_t *) &(GPIOA_REG->IDR), (volatile uint32_t *) &(GPIOB_REG->IDR), (volatile uint32_t *) &(GPIOC_REG->IDR)
+};
+
+void InputDevice::readGPIO(uint16_t *gpio) {
+  gpio[0] = *gpioIDR[0];
+  gpio[1] = *gpioIDR[1];
+  gpio[2] = *gpioIDR[2];
+}
+
+void InputDevice::resetState() {
+  state = pressedEdges = releasedEdges = 0;
+  memset(lockout, 0, sizeof(lockout));
+  memset(heldFrames, 0, sizeof(heldFrames));
+}
+
+uint16_t InputDevice::poll() {
+  uint16_t gpio[INPUT_GPIO_PORTS];
+  readGPIO(gpio);
+  return update(sample(gpio));
+}
+
+uint16_t InputDevice::update(uint16_t raw) {
+  uint16_t previous = state;
+  for (uint8_t i = 0; i < INPUT_MAX_BUTTONS; i++) {
+    uint16_t bit = 1 << i;
+    if (lockout[i]) lockout[i]--;
+    else if ((raw ^ state) & bit) {
+      state ^= bit;
+      lockout[i] = JOY_DEBOUNCE_FRAMES;
+    }
+    if (!(state & bit)) heldFrames[i] = 0;
+    else if (heldFrames[i] < 0xFFFF) heldFrames[i]++;
+  }
+  pressedEdges = state & ~previous;
+  releasedEdges = previous & ~state;
+  return state;
+}
+
+uint16_t InputDevice::held(uint16_t frames) {
+  uint16_t mask = 0;
+  for (uint8_t i = 0; i < INPUT_MAX_BUTTONS; i++)
+    if ((state & (1 << i)) && heldFrames[i] >= frames) mask |= 1 << i;
+  return mask;
+}
+
+
+uint8_t InputHub::add(InputDevice &inputDevice) {
+  if (devices == INPUT_MAX_DEVICES) return 0;
+  device[devices++] = &inputDevice;
+  return devices;
+}
+
+void InputHub::poll() {
+  uint16_t gpio[INPUT_GPIO_PORTS];
+  InputDevice::readGPIO(gpio);
+  for (uint8_t i = 0; i < devices; i++) device[i]->update(device[i]->sample(gpio));
+}
+
+uint16_t InputHub::anyPressed() {
+  uint16_t mask = 0;
+  for (uint8_t i = 0; i < devices; i++) mask |= device[i]->pressed();
+  return mask;
+}
+
@@ -0,0 +1,134 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#ifndef InputDevice_h
+#define InputDevice_h
+
+#include <stdint.h>
+
+/*
+ *
+ * InputDevice is the base class of all game controllers: Joystick, ShiftRegisterPad (NES/SNES pads) and keyboards.
+ * Each device only has to sample its raw state as a bitmask of the buttons below. Debouncing, edges and hold time
+ * are done here, the same way for any device.
+ *
+ * InputHub groups up to INPUT_MAX_DEVICES devices (players) and polls them all once per frame, taking a single
+ * snapshot of GPIOA, GPIOB and GPIOC input registers that is shared by every device.
+ * Devices resolve the GPIO registers and bit masks of their pins once, when they are set up, thus sampling and
+ * bit banging don't need digitalRead()/digitalWrite() pin table lookups.
+ *
+ * Usage Example:
+ * Joystick player1(PA0, PA1, PA2, PA3, PA4);
+ * Joystick player2(PB11, PB12, PB13, PB14, PB15);  // PA9, PB6 and PC13-PC15 are the VGA signals
+ * InputHub players;
+ *
+ * players.add(player1);
+ * players.add(player2);
+ * ...
+ * vga.waitVSync();
+ * players.poll();
+ * if (players.justPressed(1) & JOY_FIRE) ...
+ *
+ */
+
+// bit of each button in a device state
+enum {
+  JOY_LEFT   = 0x0001,
+  JOY_RIGHT  = 0x0002,
+  JOY_UP     = 0x0004,
+  JOY_DOWN   = 0x0008,
+  JOY_FIRE   = 0x0010,    // Joystick fire or pad A button
+  JOY_B      = 0x0020,
+  JOY_SELECT = 0x0040,
+  JOY_START  = 0x0080,
+  JOY_X      = 0x0100,
+  JOY_Y      = 0x0200,
+  JOY_L      = 0x0400,
+  JOY_R      = 0x0800,
+};
+
+#define INPUT_MAX_BUTTONS      12
+#define INPUT_MAX_DEVICES      4
+#define INPUT_GPIO_PORTS       3       // GPIOA, GPIOB and GPIOC
+#define JOY_DEBOUNCE_FRAMES    2       // after changing, a button state is kept for this number of poll() calls
+
+
+class InputDevice {
+ protected:
+  // latched state updated by poll()
+  uint16_t state = 0;                          // debounced state of all buttons
+  uint16_t pressedEdges = 0;                   // buttons pressed on last poll()
+  uint16_t releasedEdges = 0;                  // buttons released on last poll()
+  uint8_t lockout[INPUT_MAX_BUTTONS] = {0};    // remaining polls before each button is allowed to change again
+  uint16_t heldFrames[INPUT_MAX_BUTTONS] = {0};
+  void resetState();
+
+ public:
+    // input register of GPIOA, GPIOB and GPIOC
+    static volatile uint32_t * const gpioIDR[INPUT_GPIO_PORTS];
+    static void readGPIO(uint16_t *gpio);
+
+    // returns the raw state of all buttons - gpio is a snapshot of GPIOA, GPIOB and GPIOC input registers
+    virtual uint16_t sample(const uint16_t *gpio) = 0;
+
+    /*
+     * Latched state. Call poll() once per frame, usually right after waitVSync(), to sample all buttons at once.
+     * Debouncing doesn't delay a press: a change is accepted right away and then the button is locked for JOY_DEBOUNCE_FRAMES polls,
+     * thus a press as short as one frame is never missed and contact bouncing is filtered.
+     * All functions below return a bitmask of JOY_* buttons, related to the last poll().
+     */
+    uint16_t poll();                                            // samples buttons and returns the debounced state
+    uint16_t update(uint16_t raw);                              // debounces a raw state sampled by the caller
+    inline uint16_t pressed() { return state; }                 // buttons currently pressed
+    inline uint16_t justPressed() { return pressedEdges; }      // buttons that went from released to pressed
+    inline uint16_t justReleased() { return releasedEdges; }    // buttons that went from pressed to released
+    uint16_t held(uint16_t frames);                             // buttons pressed for at least this number of polls
+};
+
+
+class InputHub {
+ private:
+  InputDevice *device[INPUT_MAX_DEVICES];
+  uint8_t devices = 0;
+
+ public:
+    // returns the player number (1 to INPUT_MAX_DEVICES) or 0 when there is no room for another device
+    uint8_t add(InputDevice &inputDevice);
+    // polls all devices with a single GPIO snapshot
+    void poll();
+
+    inline uint8_t players() { return devices; }
+    inline InputDevice *player(uint8_t n) { return (n && n <= devices) ? device[n - 1] : 0; }
+    inline uint16_t pressed(uint8_t n) { return player(n) ? player(n)->pressed() : 0; }
+    inline uint16_t justPressed(uint8_t n) { return player(n) ? player(n)->justPressed() : 0; }
+    inline uint16_t justReleased(uint8_t n) { return player(n) ? player(n)->justReleased() : 0; }
+    uint16_t anyPressed();                                      // buttons pressed by any player
+};
+
+#endif
+
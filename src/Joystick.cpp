@@ -28,6 +28,26 @@
 
 #include <Arduino.h>
 #include "Joystick.h"
+#include "bluevgadriver.h"
+
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+#include <libmaple/adc.h>
+#include <libmaple/dma.h>
+#include <libmaple/rcc.h>
+
+#define RCC_REG       RCC_BASE
+#define ADC1_REG      ADC1_BASE
+#define ADC_DMA_REG   ((dma_channel_reg_map *) 0x40020008)    // DMA1 Channel 1 is the ADC1 request
+#endif
+
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+#define RCC_REG       RCC
+#define ADC1_REG      ADC1
+#define ADC_DMA_REG   DMA1_Channel1                           // DMA1 Channel 1 is the ADC1 request
+#endif
+
+// ADC1 CR2 for scan converted by DMA, externally triggered by TIM4 CC4 (EXTSEL = 101) once per frame during VBLANK
+#define ADC_CR2_SCAN_MODE   ((1 << 20) | (5 << 17) | (1 << 8) | 1)
 
 
 /*
@@ -63,9 +83,15 @@ void Joystick::initController(uint8_t left, uint8_t right, uint8_t up, uint8_t d
   this->upPin = up;
   this->downPin = down;
   this->firePin = fire;
+  this->xSlot = JOY_NO_CHANNEL;
+  this->ySlot = JOY_NO_CHANNEL;
+  this->analogState = 0;
+  resetState();
+  captureSlot[0] = captureSlot[1] = INPUT_GPIO_PORTS;
 
   if (leftPin == rightPin) {
     pinMode(leftPin, INPUT_ANALOG);
+    xSlot = addAdcChannel(leftPin);
   } else  {
     pinMode(leftPin, INPUT_PULLUP);
     pinMode(rightPin, INPUT_PULLUP);
@@ -73,83 +99,178 @@ void Joystick::initController(uint8_t left, uint8_t right, uint8_t up, uint8_t d
   }
   if (upPin == downPin) {
     pinMode(upPin, INPUT_ANALOG);
-
+    ySlot = addAdcChannel(upPin);
   } else  {
     pinMode(upPin, INPUT_PULLUP);
     pinMode(downPin, INPUT_PULLUP);
 
   }
   pinMode(firePin, INPUT_PULLUP);
+  if (xSlot != JOY_NO_CHANNEL || ySlot != JOY_NO_CHANNEL) startAdcScan();
+
+  uint8_t pins[JOY_INPUTS] = {leftPin, rightPin, upPin, downPin, firePin};
+  digitalInputs = (leftPin == rightPin ? 0 : JOY_LEFT | JOY_RIGHT) | (upPin == downPin ? 0 : JOY_UP | JOY_DOWN) | JOY_FIRE;
+  for (uint8_t i = 0; i < JOY_INPUTS; i++) {
+    if (!(digitalInputs & (1 << i))) continue;
+    volatile uint32_t *idr;
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+    idr = (volatile uint32_t *) &(PIN_MAP[pins[i]].gpio_device->regs->IDR);   // libmaple registers are uint32, not uint32_t
+    pinMask[i] = 1 << PIN_MAP[pins[i]].gpio_bit;
+#endif
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+    idr = &(digitalPinToPort(pins[i])->IDR);
+    pinMask[i] = digitalPinToBitMask(pins[i]);
+#endif
+    // GPIO ports are 0x400 apart from each other
+    inputPort[i] = ((uint32_t) idr - (uint32_t) gpioIDR[0]) >> 10;
+    if (inputPort[i] >= INPUT_GPIO_PORTS) digitalInputs &= ~(1 << i);    // only GPIOA to GPIOC are supported
+  }
+}
+
+// buttons are in PULL_UP state, thus pressed when the pin is driven to Ground
+uint8_t Joystick::digitalPressed(uint8_t input) {
+  if (!(digitalInputs & (1 << input))) return 0;
+  return (*gpioIDR[inputPort[input]] & pinMask[input]) ? 0 : 1;
+}
+
+
+/*
+ *  Background ADC sampling shared by all Joystick objects
+ */
+
+uint16_t Joystick::adcBuffer[JOY_ADC_SAMPLES * JOY_ADC_MAX_CHANNELS];
+uint8_t Joystick::adcChannel[JOY_ADC_MAX_CHANNELS];
+uint8_t Joystick::adcChannels = 0;
+uint32_t Joystick::adcSqr3 = 0;
+
+// adds the ADC channel of pin to the scan sequence and returns its position in it
+uint8_t Joystick::addAdcChannel(uint8_t pin) {
+  uint8_t channel = JOY_NO_CHANNEL;
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+  if (PIN_MAP[pin].adc_device == ADC1) channel = PIN_MAP[pin].adc_channel;
+#endif
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+  PinName pn = digitalPinToPinName(pin);
+  if (STM_PORT(pn) == PortA && STM_PIN(pn) < 8) channel = STM_PIN(pn);         // PA0-PA7 are ADC channels 0-7
+  if (STM_PORT(pn) == PortB && STM_PIN(pn) < 2) channel = 8 + STM_PIN(pn);     // PB0-PB1 are ADC channels 8-9
+#endif
+  if (channel == JOY_NO_CHANNEL) return JOY_NO_CHANNEL;
+
+  for (uint8_t slot = 0; slot < adcChannels; slot++)
+    if (adcChannel[slot] == channel) return slot;         // already scanned by another axis or Joystick
+  if (adcChannels == JOY_ADC_MAX_CHANNELS) return JOY_NO_CHANNEL;
+  adcChannel[adcChannels] = channel;
+  return adcChannels++;
+}
+
+// (re)configures ADC1 to scan all channels on each VBLANK trigger with DMA writing into adcBuffer in circular mode
+void Joystick::startAdcScan() {
+  if (!adcChannels) return;
+
+  // joystick at rest until the first samples arrive
+  for (uint8_t i = 0; i < JOY_ADC_SAMPLES * JOY_ADC_MAX_CHANNELS; i++) adcBuffer[i] = 2048;
+
+  RCC_REG->AHBENR |= RCC_AHBENR_DMA1EN;
+  RCC_REG->APB2ENR |= RCC_APB2ENR_ADC1EN;
+  RCC_REG->CFGR = (RCC_REG->CFGR & ~(3 << 14)) | (2 << 14);   // ADCCLK = 72MHz / 6 = 12MHz (max is 14MHz)
+
+  // power cycle ADC, thus setting ADON again won't start a conversion out of VBLANK and shift channels in the buffer
+  ADC1_REG->CR2 = 0;
+  ADC_DMA_REG->CCR = 0;
+  ADC1_REG->CR2 = 1;                                  // ADON - wake up and wait tSTAB (1us)
+  for (volatile uint8_t i = 0; i < 72; i++);
+  ADC1_REG->CR2 |= (1 << 3);                          // RSTCAL
+  while (ADC1_REG->CR2 & (1 << 3));
+  ADC1_REG->CR2 |= (1 << 2);                          // CAL
+  while (ADC1_REG->CR2 & (1 << 2));
+
+  uint32_t smpr2 = 0;
+  adcSqr3 = 0;
+  for (uint8_t slot = 0; slot < adcChannels; slot++) {
+    adcSqr3 |= adcChannel[slot] << (slot * 5);
+    smpr2 |= 7 << (adcChannel[slot] * 3);             // 239.5 cycles sample time - joystick has a high impedance
+  }
+  ADC1_REG->CR1 = (1 << 8);                           // SCAN
+  ADC1_REG->SMPR2 = smpr2;
+  ADC1_REG->SQR1 = (adcChannels - 1) << 20;
+  ADC1_REG->SQR3 = adcSqr3;
+
+  ADC_DMA_REG->CPAR = (uint32_t) &(ADC1_REG->DR);
+  ADC_DMA_REG->CMAR = (uint32_t) adcBuffer;
+  ADC_DMA_REG->CNDTR = JOY_ADC_SAMPLES * adcChannels;
+  ADC_DMA_REG->CCR = (1 << 10) | (1 << 8) | (1 << 7) | (1 << 5) | 1;   // 16 bits, memory increment, circular, enable
+
+  ADC1_REG->CR2 = ADC_CR2_SCAN_MODE;
+}
+
+// average of the last JOY_ADC_SAMPLES frames, in the same range as analogRead()
+uint16_t Joystick::readAxis(uint8_t slot) {
+  // analogRead() in the core reconfigures ADC1 - restart background scan if it happened
+  if (ADC1_REG->CR2 != ADC_CR2_SCAN_MODE || ADC1_REG->SQR3 != adcSqr3) startAdcScan();
+
+  uint32_t sum = 0;
+  uint16_t *sample = adcBuffer + slot;
+  for (uint8_t i = 0; i < JOY_ADC_SAMPLES; i++, sample += adcChannels) sum += *sample;
+  return (sum >> JOY_ADC_SAMPLES_SHIFT) >> JOY_ADC_SHIFT;
+}
+
+// high is true for directions activated above TOP_VALUE and false for those activated under BOTTOM_VALUE
+uint8_t Joystick::analogPressed(uint8_t slot, uint8_t direction, bool high) {
+  if (slot == JOY_NO_CHANNEL) return 0;
+  uint16_t value = readAxis(slot);
+  // once pressed, it is only released when value gets back JOY_HYSTERESIS apart from threshold
+  if (analogState & direction) {
+    if (high ? value < TOP_VALUE - JOY_HYSTERESIS : value > BOTTOM_VALUE + JOY_HYSTERESIS) analogState &= ~direction;
+  } else {
+    if (high ? value > TOP_VALUE : value < BOTTOM_VALUE) analogState |= direction;
+  }
+  return (analogState & direction) ? 1 : 0;
 }
 
 
 uint8_t Joystick::leftPressed(void) {
 
   if (leftPin == rightPin) {
-    if (analogRead(leftPin) > TOP_VALUE) return 1;
-    else return 0;
+    return analogPressed(xSlot, JOY_LEFT, true);
 
   } else {
-    if (digitalRead(leftPin) == LOW) {
-      return 1;
-    } else {
-      return 0;
-    }
+    return digitalPressed(0);
   }
 
 }
 
 uint8_t Joystick::rightPressed(void) {
   if (leftPin == rightPin) {
-    if (analogRead(leftPin) < BOTTOM_VALUE) return 1;
-    else return 0;
+    return analogPressed(xSlot, JOY_RIGHT, false);
 
   } else {
-    if (digitalRead(rightPin) == LOW) {
-      return 1;
-    } else {
-      return 0;
-    }
+    return digitalPressed(1);
   }
 
 }
 
 uint8_t Joystick::upPressed(void) {
   if (upPin == downPin) {
-    if (analogRead(upPin) > TOP_VALUE) return 1;
-    else return 0;
+    return analogPressed(ySlot, JOY_UP, true);
 
   } else {
-    if (digitalRead(upPin) == LOW) {
-      return 1;
-    } else {
-      return 0;
-    }
+    return digitalPressed(2);
   }
 
 }
 
 uint8_t Joystick::downPressed(void) {
   if (upPin == downPin) {
-    if (analogRead(upPin) < BOTTOM_VALUE) return 1;
-    else return 0;
+    return analogPressed(ySlot, JOY_DOWN, false);
 
   } else {
-    if (digitalRead(downPin) == LOW) {
-      return 1;
-    } else {
-      return 0;
-    }
+    return digitalPressed(3);
   }
 
 }
 
 uint8_t Joystick::firePressed(void) {
-  if (digitalRead(firePin) == LOW) {
-    return 1;
-  } else {
-    return 0;
-  }
+  return digitalPressed(4);
 }
 
 
@@ -160,6 +281,55 @@ uint8_t Joystick::anyPressed (void) {
 }
 
 
+uint16_t Joystick::sample(const uint16_t *gpio) {
+  uint16_t raw = 0;
+  // gpio is a single snapshot of each port - all buttons are sampled at the same time
+  for (uint8_t i = 0; i < JOY_INPUTS; i++)
+    if ((digitalInputs & (1 << i)) && !(gpio[inputPort[i]] & pinMask[i])) raw |= 1 << i;
+  if (leftPin == rightPin) raw |= (leftPressed() ? JOY_LEFT : 0) | (rightPressed() ? JOY_RIGHT : 0);
+  if (upPin == downPin) raw |= (upPressed() ? JOY_UP : 0) | (downPressed() ? JOY_DOWN : 0);
+  return raw;
+}
+
+
+void Joystick::captureEvents(uint16_t everyLines) {
+  // driver captures up to 2 ports - captureSlot[] has the GPIO port of each one
+  uint16_t mask[2] = {0, 0};
+  captureSlot[0] = captureSlot[1] = INPUT_GPIO_PORTS;
+  for (uint8_t i = 0; i < JOY_INPUTS; i++) {
+    if (!(digitalInputs & (1 << i))) continue;
+    for (uint8_t slot = 0; slot < 2; slot++) {
+      if (captureSlot[slot] == INPUT_GPIO_PORTS) captureSlot[slot] = inputPort[i];
+      if (captureSlot[slot] == inputPort[i]) {
+        mask[slot] |= pinMask[i];
+        break;
+      }
+    }
+  }
+  input_capture_init(captureSlot[0] < INPUT_GPIO_PORTS ? gpioIDR[captureSlot[0]] : 0, mask[0],
+                     captureSlot[1] < INPUT_GPIO_PORTS ? gpioIDR[captureSlot[1]] : 0, mask[1], everyLines);
+}
+
+void Joystick::stopCapture() {
+  input_capture_init(0, 0, 0, 0, 0);
+}
+
+bool Joystick::nextEvent(uint32_t &scanLine, uint8_t &pressedInputs) {
+  inputEvent event;
+  if (!input_capture_read(&event)) return false;
+  scanLine = event.scanLine;
+  pressedInputs = 0;
+  for (uint8_t i = 0; i < JOY_INPUTS; i++) {
+    if (!(digitalInputs & (1 << i))) continue;
+    uint32_t bit;
+    if (captureSlot[0] == inputPort[i]) bit = pinMask[i];
+    else if (captureSlot[1] == inputPort[i]) bit = (uint32_t) pinMask[i] << 16;
+    else continue;
+    if (!(event.state & bit)) pressedInputs |= 1 << i;      // buttons are pressed when driven to Ground
+  }
+  return true;
+}
+
 
 
 
@@ -29,6 +29,8 @@
 #ifndef Joystick_h
 #define Joystick_h
 
+#include "InputDevice.h"
+
 /*
  * 
  * This Class can be used with an Arduino Analog Joystick like the one viewed in this video  https://www.youtube.com/watch?v=f8iaW5YcsNE 
@@ -41,23 +43,40 @@
  * Joystick joystick(PA1, PA2, PA3, PA4, PB5);  // assumes ues of push buttons which are in PULL_UP state, thus by driving each pin to Ground will activate it
  * Joystick joystick(PA3, PA3, PA4, PA5, PB5);  // assumes a mixing of analog joystick with push butom, by using PA3 for right/left (analog), and digital signals in PA4 up, PA5 down and PB5 "fire"
  *
+ * Analog axes are not read with analogRead(). ADC1 scans all analog axes in background, triggered by the VGA driver once per frame
+ * during VBLANK (TIM4 CC4), and DMA stores the last JOY_ADC_SAMPLES frames in a circular buffer.
+ * Reading a direction is just a memory access that averages those samples, with hysteresis applied around TOP_VALUE/BOTTOM_VALUE.
+ * Analog pins must be ADC capable: PA0 to PA7 and PB0 to PB1. Axes are only sampled while VGA is running.
+ *
  */
 
 #ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
 // Analog reads from 0 to 4096 (12 bits)
 #define TOP_VALUE      4000
 #define BOTTOM_VALUE   400
+#define JOY_HYSTERESIS 200
+#define JOY_ADC_SHIFT  0
 #endif
 
 #ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
 // Analog reads from 0 to 1024 (10 bits)
 #define TOP_VALUE      900
 #define BOTTOM_VALUE   100
+#define JOY_HYSTERESIS 50
+#define JOY_ADC_SHIFT  2               // ADC is 12 bits, thus it is scaled down to 10 bits as analogRead() does in this core
 #endif
 
+#define JOY_ADC_SAMPLES        4       // number of frames averaged for each analog axis - must be a power of 2
+#define JOY_ADC_SAMPLES_SHIFT  2
+#define JOY_ADC_MAX_CHANNELS   4       // up to 4 analog axes in the ADC scan shared by all Joystick objects
+#define JOY_NO_CHANNEL         0xFF
+
+#define JOY_INPUTS             5       // left, right, up, down and fire - same order as JOY_* bits
+#define JOY_ALL                0x1F
 
 
-class Joystick {
+
+class Joystick : public InputDevice {
  private:
   uint8_t leftPin;
   uint8_t rightPin;
@@ -65,6 +84,27 @@ class Joystick {
   uint8_t downPin;
   uint8_t firePin;
 
+  uint8_t xSlot = JOY_NO_CHANNEL;     // position of left/right axis in the ADC scan sequence
+  uint8_t ySlot = JOY_NO_CHANNEL;     // position of up/down axis in the ADC scan sequence
+  uint8_t analogState = 0;            // directions currently pressed on analog axes - used for hysteresis
+
+  // ADC1 scan sequence and DMA buffer shared by all Joystick objects
+  static uint16_t adcBuffer[JOY_ADC_SAMPLES * JOY_ADC_MAX_CHANNELS];
+  static uint8_t adcChannel[JOY_ADC_MAX_CHANNELS];
+  static uint8_t adcChannels;
+  static uint32_t adcSqr3;             // expected ADC1 SQR3 - used to detect that analogRead() took over ADC1
+  static uint8_t addAdcChannel(uint8_t pin);
+  static void startAdcScan();
+  uint16_t readAxis(uint8_t slot);
+  uint8_t analogPressed(uint8_t slot, uint8_t direction, bool high);
+
+  // GPIO port and bit of each digital input, resolved in initController()
+  uint8_t digitalInputs = 0;                  // bitmask of inputs that are push buttons
+  uint8_t inputPort[JOY_INPUTS];              // GPIO port of each input: 0 is GPIOA, 1 is GPIOB and 2 is GPIOC
+  uint16_t pinMask[JOY_INPUTS];               // bit of each input in its port
+  uint8_t digitalPressed(uint8_t input);
+  uint8_t captureSlot[2];                     // GPIO ports sampled by the VGA interrupt in captureEvents()
+
  public:
     void initController(uint8_t left, uint8_t right, uint8_t up, uint8_t down, uint8_t fire);
     Joystick();
@@ -77,6 +117,21 @@ class Joystick {
     uint8_t downPressed();
     uint8_t firePressed();
     uint8_t anyPressed();
+
+    // latched state - poll(), pressed(), justPressed(), justReleased() and held() - comes from InputDevice
+    // all 5 inputs are sampled at once, returning a bitmask of JOY_LEFT, JOY_RIGHT, JOY_UP, JOY_DOWN and JOY_FIRE
+    uint16_t sample(const uint16_t *gpio);
+
+    /*
+     * Timestamped input events. Push buttons are sampled inside the VGA interrupt every <everyLines> scanlines
+     * (525 is once per frame, always at the same scanline) and each change is queued with its scanLineCounter value.
+     * Input latency and timing are then independent of how long the sketch takes to render a frame.
+     * Only push buttons are captured, analog axes are not. Push buttons may use at most 2 different GPIO ports.
+     * Only one Joystick can capture at a time.
+     */
+    void captureEvents(uint16_t everyLines = 525);
+    void stopCapture();
+    bool nextEvent(uint32_t &scanLine, uint8_t &pressedInputs);   // pops the oldest change - pressedInputs is a bitmask of JOY_*
 };
 
 #endif
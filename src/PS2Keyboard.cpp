@@ -0,0 +1,200 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include "PS2Keyboard.h"
+#include "bluevgadriver.h"
+
+// scancode set 2 to ASCII, US layout
+static const char ps2Plain[128] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\t', '`', 0,
+  0, 0, 0, 0, 0, 'q', '1', 0, 0, 0, 'z', 's', 'a', 'w', '2', 0,
+  0, 'c', 'x', 'd', 'e', '4', '3', 0, 0, ' ', 'v', 'f', 't', 'r', '5', 0,
+  0, 'n', 'b', 'h', 'g', 'y', '6', 0, 0, 0, 'm', 'j', 'u', '7', '8', 0,
+  0, ',', 'k', 'i', 'o', '0', '9', 0, 0, '.', '/', 'l', ';', 'p', '-', 0,
+  0, 0, '\'', 0, '[', '=', 0, 0, 0, 0, '\n', ']', 0, '\\', 0, 0,
+  0, 0, 0, 0, 0, 0, '\b', 0, 0, '1', 0, '4', '7', 0, 0, 0,
+  '0', '.', '2', '5', '6', '8', '\x1B', 0, 0, '+', '3', '-', '*', '9', 0, 0,
+};
+
+static const char ps2Shift[128] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\t', '~', 0,
+  0, 0, 0, 0, 0, 'Q', '!', 0, 0, 0, 'Z', 'S', 'A', 'W', '@', 0,
+  0, 'C', 'X', 'D', 'E', '$', '#', 0, 0, ' ', 'V', 'F', 'T', 'R', '%', 0,
+  0, 'N', 'B', 'H', 'G', 'Y', '^', 0, 0, 0, 'M', 'J', 'U', '&', '*', 0,
+  0, '<', 'K', 'I', 'O', ')', '(', 0, 0, '>', '?', 'L', ':', 'P', '_', 0,
+  0, 0, '"', 0, '{', '+', 0, 0, 0, 0, '\n', '}', 0, '|', 0, 0,
+  0, 0, 0, 0, 0, 0, '\b', 0, 0, '1', 0, '4', '7', 0, 0, 0,
+  '0', '.', '2', '5', '6', '8', '\x1B', 0, 0, '+', '3', '-', '*', '9', 0, 0,
+};
+
+
+volatile uint32_t *PS2Keyboard::dataIDR = 0;
+uint16_t PS2Keyboard::dataMask = 0;
+uint8_t PS2Keyboard::scanQueue[PS2_QUEUE_SIZE];
+volatile uint8_t PS2Keyboard::scanHead = 0, PS2Keyboard::scanTail = 0;
+
+
+// keyboard drives data on clock falling edge: start bit (0), 8 data bits LSB first, odd parity and stop bit (1)
+void PS2Keyboard::clockInterrupt() {
+  static uint8_t bitCount = 0, code = 0, parity = 0;
+  static uint32_t lastLine = 0;
+
+  uint8_t bit = (*dataIDR & dataMask) ? 1 : 0;
+  uint32_t line = scanLineCounter;
+  if (line - lastLine > PS2_TIMEOUT_LINES) bitCount = 0;     // lost sync - restart frame
+  lastLine = line;
+
+  if (bitCount == 0) {
+    if (bit) return;                                         // not a start bit
+    code = 0;
+    parity = 0;
+  } else if (bitCount <= 8) {
+    code |= bit << (bitCount - 1);
+    parity ^= bit;
+  } else if (bitCount == 9) {
+    parity ^= bit;
+  } else {
+    bitCount = 0;
+    uint8_t next = (scanHead + 1) & (PS2_QUEUE_SIZE - 1);
+    if (bit && parity && next != scanTail) {                 // valid stop bit and odd parity
+      scanQueue[scanHead] = code;
+      asm volatile ("" ::: "memory");     // scancode is stored before it is published
+      scanHead = next;
+    }
+    return;
+  }
+  bitCount++;
+}
+
+
+PS2Keyboard::PS2Keyboard(uint8_t clockPin, uint8_t dataPin) {
+  begin(clockPin, dataPin);
+}
+
+void PS2Keyboard::begin(uint8_t clockPin, uint8_t dataPin) {
+  resetState();
+  pinMode(clockPin, INPUT_PULLUP);
+  pinMode(dataPin, INPUT_PULLUP);
+
+  uint8_t line;      // EXTI line is the clock pin bit number
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+  dataIDR = (volatile uint32_t *) &(PIN_MAP[dataPin].gpio_device->regs->IDR);   // libmaple registers are uint32, not uint32_t
+  dataMask = 1 << PIN_MAP[dataPin].gpio_bit;
+  line = PIN_MAP[clockPin].gpio_bit;
+#endif
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+  dataIDR = &(digitalPinToPort(dataPin)->IDR);
+  dataMask = digitalPinToBitMask(dataPin);
+  line = STM_PIN(digitalPinToPinName(clockPin));
+#endif
+  attachInterrupt(digitalPinToInterrupt(clockPin), clockInterrupt, FALLING);
+
+  // EXTI0 to EXTI4 have their own interrupt, EXTI5 to EXTI9 and EXTI10 to EXTI15 share one
+  uint8_t irq = line < 5 ? 6 + line : (line < 10 ? 23 : 40);
+  NVIC_PRIORITY_REG(irq) = PS2_IRQ_PRIORITY << 4;
+}
+
+
+// translates all queued scancodes - runs in the sketch, never in the interrupt
+void PS2Keyboard::decode() {
+  while (scanTail != scanHead) {
+    asm volatile ("" ::: "memory");
+    uint8_t code = scanQueue[scanTail];
+    scanTail = (scanTail + 1) & (PS2_QUEUE_SIZE - 1);
+    decodeScancode(code);
+  }
+}
+
+void PS2Keyboard::decodeScancode(uint8_t code) {
+  if (code == 0xF0) { breakCode = true; return; }            // next code is a key release
+  if (code == 0xE0) { extended = true; return; }             // next code is an extended key
+
+  bool released = breakCode;
+  bool ext = extended;
+  breakCode = extended = false;
+
+  uint16_t joy = 0;
+  uint8_t ch = 0;
+  if (ext) {
+    switch (code) {
+      case 0x75: joy = JOY_UP;    ch = PS2_KEY_UP;    break;
+      case 0x72: joy = JOY_DOWN;  ch = PS2_KEY_DOWN;  break;
+      case 0x6B: joy = JOY_LEFT;  ch = PS2_KEY_LEFT;  break;
+      case 0x74: joy = JOY_RIGHT; ch = PS2_KEY_RIGHT; break;
+      case 0x6C: ch = PS2_KEY_HOME; break;
+      case 0x69: ch = PS2_KEY_END;  break;
+      case 0x71: ch = PS2_KEY_DEL;  break;
+      case 0x5A: joy = JOY_START; ch = '\n'; break;           // keypad Enter
+      case 0x4A: ch = '/'; break;                             // keypad '/'
+    }
+  } else {
+    switch (code) {
+      case 0x12:                                              // left and right shift
+      case 0x59: shift = !released; return;
+      case 0x58: if (!released) capsLock = !capsLock; return;
+      case 0x29: joy = JOY_FIRE;   break;                     // space
+      case 0x5A: joy = JOY_START;  break;                     // Enter
+      case 0x76: joy = JOY_SELECT; break;                     // Esc
+    }
+    if (code < 128) {
+      ch = shift ? ps2Shift[code] : ps2Plain[code];
+      if (capsLock && ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z'))) ch ^= 0x20;
+    }
+  }
+
+  if (released) {
+    keys &= ~joy;
+    return;
+  }
+  keys |= joy;
+  uint8_t next = (head + 1) & (PS2_BUFFER_SIZE - 1);
+  if (ch && next != tail) {
+    buffer[head] = ch;
+    head = next;
+  }
+}
+
+uint8_t PS2Keyboard::available() {
+  decode();
+  return (head - tail) & (PS2_BUFFER_SIZE - 1);
+}
+
+int PS2Keyboard::read() {
+  decode();
+  if (head == tail) return -1;
+  uint8_t ch = buffer[tail];
+  tail = (tail + 1) & (PS2_BUFFER_SIZE - 1);
+  return ch;
+}
+
+uint16_t PS2Keyboard::sample(const uint16_t *gpio) {
+  decode();
+  return keys;
+}
+
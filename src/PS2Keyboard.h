@@ -0,0 +1,94 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#ifndef PS2Keyboard_h
+#define PS2Keyboard_h
+
+#include "InputDevice.h"
+
+/*
+ *
+ * This Class reads a PS/2 keyboard. Clock pin uses an external interrupt (EXTI) that only shifts in the 11 bits
+ * of each frame and queues the scancode. Its priority is set below the VGA interrupt, thus it never delays a scanline.
+ * Scancodes (set 2, US layout) are translated into ASCII when the sketch reads them, thus characters can be fed directly
+ * into BlueVGA::write() or print() for a simple terminal:
+ *
+ * PS2Keyboard keyboard(PB8, PB9);       // clock on PB8, data on PB9 - any pins, but clock must be on its own EXTI line
+ * ...
+ * while (keyboard.available()) vga.write(keyboard.read());
+ *
+ * Keyboard is also an InputDevice: arrows are JOY_LEFT/RIGHT/UP/DOWN, space is JOY_FIRE, Enter is JOY_START and Esc is JOY_SELECT.
+ * Only one PS2Keyboard object can be used. PS/2 is a 5V bus: use 5V tolerant pins (PB8 and PB9 are).
+ *
+ */
+
+#define PS2_QUEUE_SIZE         16      // scancodes waiting to be decoded - must be a power of 2
+#define PS2_BUFFER_SIZE        16      // ASCII characters waiting to be read - must be a power of 2
+#define PS2_IRQ_PRIORITY       15      // lowest priority, VGA interrupt is 0
+#define PS2_TIMEOUT_LINES      63      // about 2ms - a longer gap between clock edges restarts the frame
+
+// keys that have no ASCII code
+enum {
+  PS2_KEY_UP    = 0x80,
+  PS2_KEY_DOWN  = 0x81,
+  PS2_KEY_LEFT  = 0x82,
+  PS2_KEY_RIGHT = 0x83,
+  PS2_KEY_HOME  = 0x84,
+  PS2_KEY_END   = 0x85,
+  PS2_KEY_DEL   = 0x7F,
+};
+
+
+class PS2Keyboard : public InputDevice {
+ private:
+  // written by the clock interrupt
+  static volatile uint32_t *dataIDR;
+  static uint16_t dataMask;
+  static uint8_t scanQueue[PS2_QUEUE_SIZE];
+  static volatile uint8_t scanHead, scanTail;
+  static void clockInterrupt();
+
+  // decoder state
+  bool breakCode = false, extended = false, shift = false, capsLock = false;
+  uint16_t keys = 0;                         // JOY_* bits of keys currently held down
+  uint8_t buffer[PS2_BUFFER_SIZE];
+  uint8_t head = 0, tail = 0;
+  void decode();
+  void decodeScancode(uint8_t code);
+
+ public:
+    PS2Keyboard(uint8_t clockPin, uint8_t dataPin);
+    void begin(uint8_t clockPin, uint8_t dataPin);
+
+    uint8_t available();                     // number of characters ready to be read
+    int read();                              // returns -1 when there is no character
+    uint16_t sample(const uint16_t *gpio);   // keys held down as JOY_* bits
+};
+
+#endif
+
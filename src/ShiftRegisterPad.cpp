@@ -0,0 +1,96 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include "ShiftRegisterPad.h"
+
+// order in which buttons are shifted out of the pad
+static const uint16_t nesButtons[NES_PAD] = {JOY_FIRE, JOY_B, JOY_SELECT, JOY_START, JOY_UP, JOY_DOWN, JOY_LEFT, JOY_RIGHT};
+static const uint16_t snesButtons[SNES_PAD] = {JOY_B, JOY_Y, JOY_SELECT, JOY_START, JOY_UP, JOY_DOWN, JOY_LEFT, JOY_RIGHT,
+                                               JOY_FIRE, JOY_X, JOY_L, JOY_R, 0, 0, 0, 0};
+
+static inline void padDelay() {
+  for (volatile uint8_t i = 0; i < PAD_DELAY_LOOPS; i++);
+}
+
+
+ShiftRegisterPad::ShiftRegisterPad(uint8_t latch, uint8_t clock, uint8_t data, padType type) {
+  initController(latch, clock, data, type);
+}
+
+void ShiftRegisterPad::initController(uint8_t latch, uint8_t clock, uint8_t data, padType type) {
+  bits = type;
+  resetState();
+
+  pinMode(latch, OUTPUT);
+  pinMode(clock, OUTPUT);
+  pinMode(data, INPUT_PULLUP);
+
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+  // libmaple registers are uint32 (unsigned int), not uint32_t (unsigned long)
+  latchBSRR = (volatile uint32_t *) &(PIN_MAP[latch].gpio_device->regs->BSRR);
+  latchMask = 1 << PIN_MAP[latch].gpio_bit;
+  clockBSRR = (volatile uint32_t *) &(PIN_MAP[clock].gpio_device->regs->BSRR);
+  clockMask = 1 << PIN_MAP[clock].gpio_bit;
+  dataIDR = (volatile uint32_t *) &(PIN_MAP[data].gpio_device->regs->IDR);
+  dataMask = 1 << PIN_MAP[data].gpio_bit;
+#endif
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+  latchBSRR = &(digitalPinToPort(latch)->BSRR);
+  latchMask = digitalPinToBitMask(latch);
+  clockBSRR = &(digitalPinToPort(clock)->BSRR);
+  clockMask = digitalPinToBitMask(clock);
+  dataIDR = &(digitalPinToPort(data)->IDR);
+  dataMask = digitalPinToBitMask(data);
+#endif
+
+  *latchBSRR = (uint32_t) latchMask << 16;    // latch low
+  *clockBSRR = clockMask;          // clock idles high
+}
+
+uint16_t ShiftRegisterPad::sample(const uint16_t *gpio) {
+  const uint16_t *buttons = bits == SNES_PAD ? snesButtons : nesButtons;
+  uint16_t raw = 0;
+
+  // latch pulse loads all buttons into the shift register and first button is available on data
+  *latchBSRR = latchMask;
+  padDelay();
+  padDelay();
+  *latchBSRR = (uint32_t) latchMask << 16;
+  padDelay();
+
+  for (uint8_t i = 0; i < bits; i++) {
+    if (!(*dataIDR & dataMask)) raw |= buttons[i];    // a pressed button is read as 0
+    *clockBSRR = (uint32_t) clockMask << 16;
+    padDelay();
+    *clockBSRR = clockMask;         // rising edge shifts next button to data
+    padDelay();
+  }
+  return raw;
+}
+
@@ -0,0 +1,74 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#ifndef ShiftRegisterPad_h
+#define ShiftRegisterPad_h
+
+#include "InputDevice.h"
+
+/*
+ *
+ * This Class reads NES or SNES game pads. Those pads have a parallel-in serial-out shift register (4021) that is
+ * read by bit banging 3 pins: latch, clock and data. Buttons are returned as JOY_* bits, thus a pad can be used
+ * in place of a Joystick and added to an InputHub.
+ *
+ * NES pad connector:   +5V (or 3.3V), GND, Latch (Strobe), Clock, Data
+ *
+ * Usage Example:
+ * ShiftRegisterPad pad(PB12, PB13, PB14);               // NES pad with latch on PB12, clock on PB13 and data on PB14
+ * ShiftRegisterPad pad(PB12, PB13, PB14, SNES_PAD);     // SNES pad on the same pins
+ *
+ * Reading a SNES pad takes about 40 microseconds, thus it shall be done once per frame, using poll().
+ *
+ */
+
+typedef enum {
+  NES_PAD  = 8,     // A, B, Select, Start, Up, Down, Left, Right
+  SNES_PAD = 16,    // B, Y, Select, Start, Up, Down, Left, Right, A, X, L, R and 4 unused bits
+} padType;
+
+#define PAD_DELAY_LOOPS     8      // about 1 microsecond at 72MHz - half period of the clock signal
+
+
+class ShiftRegisterPad : public InputDevice {
+ private:
+  uint8_t bits = NES_PAD;
+  volatile uint32_t *latchBSRR, *clockBSRR;   // output pins are set/reset through BSRR
+  volatile uint32_t *dataIDR;
+  uint16_t latchMask, clockMask, dataMask;
+
+ public:
+    ShiftRegisterPad(uint8_t latch, uint8_t clock, uint8_t data, padType type = NES_PAD);
+    void initController(uint8_t latch, uint8_t clock, uint8_t data, padType type = NES_PAD);
+
+    // shifts all bits out of the pad - gpio snapshot is not used because data is serial
+    uint16_t sample(const uint16_t *gpio);
+};
+
+#endif
+
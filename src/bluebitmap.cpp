@@ -30,12 +30,46 @@
 #include "bluevgadriver.h"
 #include "bluebitmap.h"
 
+#if VGA_MIXED_TILES
+uint8_t BlueBitmap::nextFreeTile = RAM_BANK_FIRST_TILE;   // Tiles 0..127 are in the Flash bank
+uint8_t BlueBitmap::firstFreeTile = RAM_BANK_FIRST_TILE;
+#else
 uint8_t BlueBitmap::nextFreeTile = 1;       // Tile 0 is used as default background
 uint8_t BlueBitmap::firstFreeTile = 1;      // reference index of the first usable tile for drwaing pixels on the screen
+#endif
 uint8_t BlueBitmap::ramFont[256 * 8] = {0}; // RAM Font Bitmap used to draw pixels
+#if VGA_FRAME_WINDOW
+uint8_t *BlueBitmap::frameBuffer = NULL;
+uint8_t BlueBitmap::frameBytesPerLine = 0, BlueBitmap::frameLines = 0;
+#endif
 
 
+// is the Tile we will draw already used for drawing pixel or we must alocate a new tile from the pool?
+uint8_t BlueBitmap::drawingTile(uint8_t xTile, uint8_t yTile) {
+  uint8_t tileIdx = TRAM[yTile][xTile];
+#if VGA_MIXED_TILES
+  // Flash bank tiles can't be drawn, thus they are replaced by a RAM tile with the same bitmap
+  if (tileIdx < RAM_BANK_FIRST_TILE) {
+    uint8_t flashTile = tileIdx;
+    tileIdx = nextFreeTile++;
+    copyFont2RamTile(flashTile, TBitmap, tileIdx);
+#else
+  if (!tileIdx) {     // we must alocate a free tile to draw the pixel
+    tileIdx = nextFreeTile++;
+#endif
+    // set the allocated tile in the screen
+    TRAM[yTile][xTile] = tileIdx;
+    // if we used all possible free tiles, we just restart it... is it good?
+    if (nextFreeTile == (uint8_t) RAM_FONT_TILES) nextFreeTile = firstFreeTile;
+  }
+  return tileIdx;
+}
+
 void BlueBitmap::drawPixel(uint8_t x, uint8_t y, bool setReset) {
+#if VGA_TILE_2BPP
+  // with 2bpp tiles, a set pixel takes the brightest color of the palette and a reset one the background color
+  drawPixelColor(x, y, setReset ? 3 : 0);
+#else
   // clip x and y to the limits of the screen, just in case...
   x %= (VRAM_WIDTH << 3);
   y %= (VRAM_HEIGHT << 3);
@@ -48,15 +82,7 @@ void BlueBitmap::drawPixel(uint8_t x, uint8_t y, bool setReset) {
   uint8_t xPos = x & 7;
   uint8_t yPos = y & 7;
 
-  // is the Tile we will draw already used for drawing pixel or we must alocate a new tile from the pool?
-  uint8_t tileIdx = TRAM[yTile][xTile];
-  if (!tileIdx) {     // we must alocate a free tile to draw the pixel
-    tileIdx = nextFreeTile++;
-    // set the allocated tile in the screen
-    TRAM[yTile][xTile] = tileIdx;
-    // if we used all possible free tiles, we just restart it... is it good?
-    if (!nextFreeTile) nextFreeTile = firstFreeTile;
-  }
+  uint8_t tileIdx = drawingTile(xTile, yTile);
 
   // set the mask for AND / OR operation on the pixel (bit) we want to draw
   uint8_t mask = setReset ? (1 << (7 - xPos)) : ~ (1 << (7 - xPos));
@@ -65,14 +91,71 @@ void BlueBitmap::drawPixel(uint8_t x, uint8_t y, bool setReset) {
   uint8_t *tileY = ramFont + (tileIdx << 3) + yPos;
   if (setReset) *tileY |= mask;
   else *tileY &= mask;
+#endif
+}
+
+#if VGA_TILE_2BPP
+void BlueBitmap::drawPixelColor(uint8_t x, uint8_t y, uint8_t colorIndex) {
+  // clip x and y to the limits of the screen, just in case...
+  x %= (VRAM_WIDTH << 3);
+  y %= (VRAM_HEIGHT << 3);
+
+  // get the tile position in the screen
+  uint8_t xTile = (x >> 3);
+  uint8_t yTile = (y >> 3);
+
+  // same tile allocation as drawPixel()
+  uint8_t tileIdx = drawingTile(xTile, yTile);
+
+  // 2 bytes per pixel line, 4 pixels per byte with the leftmost one in bits 7-6
+  uint8_t *tileY = ramFont + tileIdx * TILE_BYTES + ((y & 7) << 1) + ((x & 7) >> 2);
+  uint8_t shift = (3 - (x & 3)) << 1;
+  *tileY = (*tileY & ~(3 << shift)) | ((colorIndex & 3) << shift);
+}
+#endif
+
+#if VGA_FRAME_WINDOW
+void BlueBitmap::setFrameWindow(uint8_t *buffer, uint8_t tileX, uint8_t tileY, uint8_t tilesW, uint8_t tilesH) {
+  // same clipping as the driver does - a window that starts off the screen is hidden
+  if (tileX >= VRAM_WIDTH || tileY >= VRAM_HEIGHT) {
+    hideFrameWindow();
+    return;
+  }
+  if (tileX + tilesW > VRAM_WIDTH) tilesW = VRAM_WIDTH - tileX;
+  if (tileY + tilesH > VRAM_HEIGHT) tilesH = VRAM_HEIGHT - tileY;
+  frameBuffer = buffer;
+  frameBytesPerLine = tilesW;
+  frameLines = tilesH * TILE_H;
+  video_set_window(buffer, tileX, tileY, tilesW, tilesH);
+}
+
+void BlueBitmap::hideFrameWindow() {
+  frameBuffer = NULL;
+  video_set_window(NULL, 0, 0, 0, 0);
 }
 
+void BlueBitmap::drawFramePixel(uint8_t x, uint8_t y, bool setReset) {
+  if (!frameBuffer || (x >> 3) >= frameBytesPerLine || y >= frameLines) return;
+  uint8_t *pixels = frameBuffer + y * frameBytesPerLine + (x >> 3);
+  if (setReset) *pixels |= 0x80 >> (x & 7);
+  else *pixels &= ~(0x80 >> (x & 7));
+}
+
+void BlueBitmap::clearFrameWindow() {
+  if (frameBuffer) memset(frameBuffer, 0, frameBytesPerLine * frameLines);
+}
+#endif
+
 // just erase memory using 32bits at once -> faster
 void BlueBitmap::eraseRamTiles() {
-  uint32_t *ramTile32Bits = (uint32_t *) (ramFont + (firstFreeTile << 3));
+  uint32_t *ramTile32Bits = (uint32_t *) (ramFont + firstFreeTile * TILE_BYTES);
   for (uint8_t i = firstFreeTile; i < nextFreeTile; i++) {
     *ramTile32Bits++ = 0;
     *ramTile32Bits++ = 0;
+#if VGA_TILE_2BPP
+    *ramTile32Bits++ = 0;
+    *ramTile32Bits++ = 0;
+#endif
   }
   nextFreeTile = firstFreeTile;
 }
@@ -86,14 +169,11 @@ void BlueBitmap::clearGraphScreen(uint8_t color) {
   // set tile color in the screen
   uint32_t *CRAM32Bits = (uint32_t *) CRAM;
   uint32_t color32Bits = color << 24 | color << 16 | color << 8 | color;
-  // faster using 32 bits operations
-  for (uint8_t y = 0; y < VRAM_HEIGHT; y++) {
-    // 4 x 7 = 28 tiles
-    *TRAM32Bits++ = 0; *TRAM32Bits++ = 0; *TRAM32Bits++ = 0; *TRAM32Bits++ = 0; 
-    *TRAM32Bits++ = 0; *TRAM32Bits++ = 0; *TRAM32Bits++ = 0;
-    // 4 x 7 = 28 Colors
-    *CRAM32Bits++ = color32Bits; *CRAM32Bits++ = color32Bits; *CRAM32Bits++ = color32Bits; 
-    *CRAM32Bits++ = color32Bits; *CRAM32Bits++ = color32Bits; *CRAM32Bits++ = color32Bits; 
+  // faster using 32 bits operations - 4 tiles and 4 colors at once
+  for (uint16_t i = VRAM_HEIGHT * VRAM_ROW_WORDS; i; i--) {
+    *TRAM32Bits++ = 0;
+  }
+  for (uint16_t i = VRAM_HEIGHT * CRAM_ROW_WORDS; i; i--) {
     *CRAM32Bits++ = color32Bits;
   }
 }
@@ -102,10 +182,28 @@ void BlueBitmap::copyFont2RamTile (uint8_t flashFontChar, const uint8_t *fontBit
   if (!fontBitmap) return;
 
   // faster using 32 bits operations
-  uint32_t *ramTile32Bits = (uint32_t *) (ramFont + (ramFontTileNumber << 3));
-  uint32_t *fontBitmap32Bits = (uint32_t *) (fontBitmap + (flashFontChar << 3));
+  uint32_t *ramTile32Bits = (uint32_t *) (ramFont + ramFontTileNumber * TILE_BYTES);
+  uint32_t *fontBitmap32Bits = (uint32_t *) (fontBitmap + flashFontChar * TILE_BYTES);
+  *ramTile32Bits++ = *fontBitmap32Bits++;
   *ramTile32Bits++ = *fontBitmap32Bits++;
+#if VGA_TILE_2BPP
   *ramTile32Bits++ = *fontBitmap32Bits++;
+  *ramTile32Bits++ = *fontBitmap32Bits++;
+#endif
+}
+
+// a single run of 32 bits copies, unrolled by tile - a memory to memory DMA would be as fast, but it takes
+// bus cycles from the VGA interrupt while a scanline is sent, which shows as jitter on the screen
+void BlueBitmap::loadFontToRam(const uint8_t *font, uint8_t first, uint16_t count, uint8_t ramFontTileNumber) {
+  if (!font || ramFontTileNumber >= RAM_FONT_TILES) return;
+  if (ramFontTileNumber + count > RAM_FONT_TILES) count = RAM_FONT_TILES - ramFontTileNumber;
+
+  uint32_t *ramTile32Bits = (uint32_t *) (ramFont + ramFontTileNumber * TILE_BYTES);
+  const uint32_t *fontBitmap32Bits = (const uint32_t *) (font + first * TILE_BYTES);
+  for (uint16_t i = count * (TILE_BYTES / 8); i; i--) {
+    *ramTile32Bits++ = *fontBitmap32Bits++;
+    *ramTile32Bits++ = *fontBitmap32Bits++;
+  }
 }
 
 
@@ -136,7 +234,7 @@ void BlueBitmap::drawBitmap(uint8_t x, uint8_t y, uint8_t frameNum, bool setRese
     uint8_t yTile = (y >> 3);
     for (uint8_t y = yTile; y < yTile + (height >> 3) + 1; y++)
       for (uint8_t x = xTile; x < xTile + (width >> 3) + 1; x++)
-        CRAM[y][x] = color;
+        CRAM_CELL(y, x) = color;
   }
 }
 
@@ -148,6 +246,11 @@ void BlueBitmap::drawBitmap(uint8_t x, uint8_t y, uint8_t frameNum, bool setRese
 // Very special case of Bitmap here. ONLY 8x8 or 16x8 bitmaps, but very FAST!
 void BlueBitmap::drawBitmap8(uint8_t x, uint8_t y, uint8_t frameNum, bool setReset, int8_t color) {
   if (!bitmap || !width || !height) return;
+#if VGA_TILE_2BPP
+  // the fast path works on 1bpp RAM tiles only
+  drawBitmap(x, y, frameNum, setReset, color);
+  return;
+#endif
 
   // clip x and y to the limits of the screen, just in case...
   x %= (VRAM_WIDTH << 3);
@@ -175,15 +278,10 @@ void BlueBitmap::drawBitmap8(uint8_t x, uint8_t y, uint8_t frameNum, bool setRes
     uint8_t yPosAux = th ? 0 : yPos;           // upper tile? shall we start on yPos or 0?
     for (uint8_t tw = 0; tw < tilesW; tw++) {  // tilesW will be 1, 2 ou 3...
       // is the tile at the position equal to zero? We must replace it with a new RAM Tile from the pool
-      uint8_t tileIdx = TRAM[yTile + th][xTile + tw];
-      if (tileIdx == 0) {
-        tileIdx = nextFreeTile++;
-        TRAM[yTile + th][xTile + tw] = tileIdx;
-        if (!nextFreeTile) nextFreeTile = firstFreeTile;
-      }
+      uint8_t tileIdx = drawingTile(xTile + tw, yTile + th);
 
       if (((uint8_t)color) < 16) {   // skip this if color = -1 (DO_NOT_PAINT_COLOR)
-        CRAM[yTile + th][xTile + tw] = color;
+        CRAM_CELL(yTile + th, xTile + tw) = color;
       }
 
       // find the right byte on ramFont bitmap and set or reset the pixel
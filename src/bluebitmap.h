@@ -36,6 +36,9 @@
 // used when creating a BlueVGA object with our local RAM font as Bitmap source
 #define USE_RAM BlueBitmap::ramFont
 
+// bytes of a frame window buffer with the size of tilesW x tilesH tiles
+#define FRAME_BUFFER_SIZE(tilesW, tilesH)   ((tilesW) * (tilesH) * TILE_H)
+
 #ifdef __cplusplus
 class BlueBitmap {
 
@@ -48,8 +51,13 @@ class BlueBitmap {
     // We can set a tile at any place on the screen and draw its pixels one by one
 
     static BlueVGA *blueVgaObject;
+#if VGA_FRAME_WINDOW
+    static uint8_t *frameBuffer;
+    static uint8_t frameBytesPerLine, frameLines;
+#endif
     static uint8_t nextFreeTile;       // Tile 0 is used as default background
     static uint8_t firstFreeTile;      // reference index of the first usable tile for drwaing pixels on the screen
+    static uint8_t drawingTile(uint8_t xTile, uint8_t yTile);   // RAM tile of a screen cell, allocated from the pool if needed
 
   public:
     // this function dinamicaly allocates RAM tiles from ramFont when necessary and set it to the position
@@ -59,6 +67,10 @@ class BlueBitmap {
     // end up reusing some tiles and messing up the screen
     // There is a limit of 256 tiles, thus a total of sort of "agglutinated" 16K pixels 
     static void drawPixel(uint8_t x, uint8_t y, bool setReset = true);
+#if VGA_TILE_2BPP
+    // sets the pixel to one of the 4 colors (0 to 3) of the palette of its tile - with 2bpp tiles, there are 128 RAM tiles
+    static void drawPixelColor(uint8_t x, uint8_t y, uint8_t colorIndex);
+#endif
 
     // this function uses drawPixel to ser or reset each pixel as decribed on the bitmap of any size
     // it may be too slow to draw may bitmaps or even to a very large one
@@ -72,6 +84,11 @@ class BlueBitmap {
     // into the RAM Font space at the ramFontTileNumber tile position
     static void copyFont2RamTile (uint8_t flashFontChar, const uint8_t *fontBitmap, uint8_t ramFontTileNumber);
 
+    // copies count tiles of font, from tile first on, into the RAM Font space at once - tiles keep their numbers
+    // unless ramFontTileNumber is given. It is meant for the sketch setup, such as loadFontToRam(ASCII_FONT, 0, 128)
+    static void loadFontToRam(const uint8_t *font, uint8_t first, uint16_t count, uint8_t ramFontTileNumber);
+    static void loadFontToRam(const uint8_t *font, uint8_t first, uint16_t count) { loadFontToRam(font, first, count, first); }
+
     // sets 0 to all RAM tiles starting on firstFreeTile and resets nextFreeTile to it
     // in a graphic context, we may want to keep some tiles fixed for some purpose
     // only tiles after firstFreeTile are used to set/reset pixels
@@ -79,6 +96,16 @@ class BlueBitmap {
     // important note is that usually tile 0 is used to fill al the screen with a pattern
     // that usually is a blank character such as ' '
     static void eraseRamTiles();
+
+#if VGA_FRAME_WINDOW
+    // Frame window: a tile aligned rectangle of the screen that displays a linear 1bpp frame buffer (see vgaProperties.h)
+    // buffer is provided by the sketch with FRAME_BUFFER_SIZE(tilesW, tilesH) bytes, 1 bit per pixel, leftmost pixel in bit 7
+    // drawFramePixel() uses window coordinates and never allocates RAM tiles - the window keeps the CRAM colors of its tiles
+    static void setFrameWindow(uint8_t *buffer, uint8_t tileX, uint8_t tileY, uint8_t tilesW, uint8_t tilesH);
+    static void hideFrameWindow();
+    static void drawFramePixel(uint8_t x, uint8_t y, bool setReset = true);
+    static void clearFrameWindow();
+#endif
     static void clearGraphScreen(uint8_t color = ((RGB_YELLOW << 4) | RGB_BLUE));  // Yellow over blue background
 
     // simple constructors, no desctructor needed
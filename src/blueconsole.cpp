@@ -0,0 +1,102 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS.
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "Arduino.h"
+#include "bluevgadriver.h"
+#include "blueconsole.h"
+
+
+void BlueConsole::setWindow(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+  left = x < VRAM_WIDTH ? x : VRAM_WIDTH - 1;
+  top = y < VRAM_HEIGHT ? y : VRAM_HEIGHT - 1;
+  width = w > VRAM_WIDTH - left ? VRAM_WIDTH - left : (w ? w : 1);
+  height = h > VRAM_HEIGHT - top ? VRAM_HEIGHT - top : (h ? h : 1);
+  cursorX = 0;
+  cursorY = 0;
+}
+
+void BlueConsole::clear() {
+  // same as scrolling all the window rows out
+  vga->scrollRegion(left, top, width, height, height, ' ', getTextColor());
+  cursorX = 0;
+  cursorY = 0;
+}
+
+void BlueConsole::scroll(uint8_t lines) {
+  vga->scrollRegion(left, top, width, height, lines, ' ', getTextColor());
+}
+
+// same rules as BlueVGA::write(), inside the window
+size_t BlueConsole::write(uint8_t ch) {
+
+  if (cursorY == height) {           // does it overflow window bottom?
+    cursorY = height - 1;            // keep cursorY at last line of the window
+    scroll();                        // scroll window text up 1 line
+  }
+  if (ch == '\r') cursorX = 0;           // places cursor at the begining of the line
+  else {
+    // prints the character in the window and updates cursor position -- only ASCII printable characters
+    if (cursorX < width && ch > 31 && ch < 127) {
+      TRAM[top + cursorY][left + cursorX] = ch;
+      CRAM_CELL(top + cursorY, left + cursorX) = getTextColor();
+      cursorX++;
+    }
+    if (ch == '\t')                      // TAB aligns to the next X that is multiple of textTabSize
+      cursorX = ((cursorX + textTabSize) / textTabSize) * textTabSize;
+    if (ch == '\n' || (cursorX >= width && wrap)) { // check wrapping
+      cursorX = 0;
+      cursorY++;
+    }
+  }
+  return 1;
+}
+
+
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+size_t BlueConsole::write(const uint8_t *buf, size_t len)
+#endif
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+size_t BlueConsole::write(const void *buf, uint32_t len)
+#endif
+{
+  uint8_t *strBuf = (uint8_t *) buf;
+  size_t n = 0;
+  for (uint16_t i = 0; i < len; i++) {
+    size_t ret = write(strBuf[i]);
+    if (!ret) break;
+    n += ret;
+  }
+  return n;
+}
+
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+size_t BlueConsole::write(const char *str) {
+  if (str) return (write((const void *)str, strlen(str)));
+  else return 0;
+}
+#endif
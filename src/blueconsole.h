@@ -0,0 +1,104 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#ifndef BLUE_CONSOLE_H
+#define BLUE_CONSOLE_H
+
+#include "bluevga.h"
+
+#ifdef __cplusplus
+/*
+    Text window with its own cursor, colors, wrapping and tab size, printed with print() and println() as BlueVGA.
+    Many consoles can share the screen: each one only writes and scrolls the tiles of its own rectangle, thus
+    headers, status lines or other windows around it are never overwritten.
+    Cursor coordinates are relative to the top left corner of the window.
+
+      BlueVGA vga(ASCII_FONT);
+      BlueConsole console(vga, 0, 2, VRAM_WIDTH, VRAM_HEIGHT - 2);   // rows 0 and 1 are a fixed header
+*/
+class BlueConsole : public Print {
+
+  private:
+    BlueVGA *vga;
+    uint8_t left, top, width, height;  // window rectangle in tiles
+    uint8_t cursorX = 0, cursorY = 0;  // cursor position inside the window
+    bool wrap = true;                  // define if print beyond right window margin will coninue on next line
+    uint8_t fgColor = RGB_WHITE, bgColor = RGB_BLACK;         // colors for foreground and background when printing
+    uint8_t textTabSize = 4;           // default set TAB in 4 spaces
+
+  public:
+#ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
+    size_t write(uint8_t ch);
+    size_t write(const uint8_t *buffer, size_t size);
+#endif
+
+#ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
+    size_t write(uint8_t ch);            // implementing virtual function write() to implement Print Class
+    size_t write(const char *str);
+    size_t write(const void *buf, uint32_t len);
+#endif
+
+    BlueConsole(BlueVGA &v, uint8_t x, uint8_t y, uint8_t w, uint8_t h) : vga(&v) { setWindow(x, y, w, h); }
+
+    // moves or resizes the window, clipped to the screen - it doesn't redraw anything and the cursor goes home
+    void setWindow(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+    // fills the window with ' ' in the text colors and places the cursor at its top left corner
+    void clear();
+    // scrolls up the window rows only, the new bottom lines are ' ' in the text colors
+    void scroll(uint8_t lines = 1);
+
+    inline void setTextColor(uint8_t cfg = RGB_WHITE) {
+        fgColor = cfg;
+    }
+    inline void setTextColor(uint8_t cfg, uint8_t cbg) {
+        fgColor = cfg;
+        bgColor = cbg;
+    }
+    inline uint8_t getTextColor() {
+        return ((bgColor << 4) | (fgColor & 0x0F));
+    }
+    inline void setTextCursor(uint8_t x = 0, uint8_t y = 0) {
+        cursorX = x < width ? x : width;
+        cursorY = y < height ? y : height;
+    }
+    inline void setTextWrap(bool w = true) {
+        wrap = w;
+    }
+    inline uint8_t getTextCursorX() {
+        return(cursorX);
+    }
+    inline uint8_t getTextCursorY() {
+        return(cursorY);
+    }
+    inline void setTextTab(uint8_t t = 4) {
+        textTabSize = t ? t : 1;
+    }
+};
+
+#endif
+#endif
@@ -0,0 +1,71 @@
+/*
+   BlueVGA library - VGA Driver Library for STM32F103
+
+   - This library is intended to work in Arduino IDE using Bluepill STM32F103C8 or STM32F103CB boards
+   - It works on both STM32 Core and Roger's core for STM32F103C board.
+   - It was tested and runs using the following Arduino Settings for the board:
+       Generic STM32F103C series
+       Optimize Os (Smallest)
+       Variant STM32F103C8 or STM32F103CB
+       CPU Speed(MHz) 72MHz (Normal)
+
+    Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+    Copyright © 2017-2021 Rodrigo Patricio Garcia Corbera. 
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+    This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+    Redistributions of source code must retain the above copyright notice, and meet al conditions as defined in  https://creativecommons.org/licenses/by-nc-sa/4.0/legalcode.
+    Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the this disclaimer in 
+    the documentation and/or other materials provided with the distribution.
+
+    ** THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. 
+    ** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS,
+    ** WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#ifndef BLUE_FONTS_H
+#define BLUE_FONTS_H
+
+#include <stdint.h>
+#include "vgaProperties.h"
+
+/*
+    Built-in Flash fonts - 8x8 pixels, 8 bytes per tile, one byte per pixel line with the leftmost pixel in bit 7.
+    They are defined once in bluefonts.c, thus every sketch file that includes this header shares the same copy.
+    All of them are const (Flash) and 4 bytes aligned, so they can be used directly with BlueVGA(), setFontBitmap()
+    and BlueBitmap::copyFont2RamTile() with no RAM copy.
+    Each font can be left out of the build in vgaProperties.h (VGA_FONT_ASCII, VGA_FONT_CGA, VGA_FONT_CGA_LIGHT).
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if VGA_FONT_ASCII
+// ASCII 0..127, the default font of the examples
+extern const uint8_t blueFontASCII[128 * 8];
+#endif
+
+#if VGA_FONT_CGA
+// IBM CGA 8x8 - tiles 0..127 are Code page 437 + ASCII, tiles 128..223 are ISO-8859-1 characters 160..255
+extern const uint8_t blueFontCGA[224 * 8];
+#endif
+
+#if VGA_FONT_CGA_LIGHT
+// IBM CGA Light 8x8 - same characters as blueFontCGA with thinner strokes
+extern const uint8_t blueFontCGALight[224 * 8];
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+// names used by the font.h files of older sketches
+#define ASCII_FONT            blueFontASCII
+#define font8x8_ic8x8u        blueFontCGA
+#define font8x8_icl8x8u       blueFontCGALight
+
+#endif
@@ -29,6 +29,9 @@
 #include <Arduino.h>
 #include "bluevga.h"
 #include "bluevgadriver.h"
+#if VGA_MIXED_TILES
+#include "bluebitmap.h"
+#endif
 
 
 /*
@@ -37,11 +40,107 @@
 
 */
 
+// fills len bytes of a VRAM row - unaligned bytes at both edges and 32 bits words in the aligned middle
+static void fillRow(uint8_t *dst, uint8_t len, uint8_t value) {
+  while (len && ((uint32_t) dst & 3)) {
+    *dst++ = value;
+    len--;
+  }
+  uint32_t fourBytes = value * 0x01010101UL;
+  uint32_t *dst32Bits = (uint32_t *) dst;
+  for (; len >= 4; len -= 4) {
+    *dst32Bits++ = fourBytes;
+  }
+  dst = (uint8_t *) dst32Bits;
+  while (len--) *dst++ = value;
+}
+
+// copies len bytes between two VRAM rows at the same column - rows are multiple of 4 bytes, thus both edges have the
+// same alignment and the middle is copied with 32 bits words
+static void copyRow(uint8_t *dst, const uint8_t *src, uint8_t len) {
+  while (len && ((uint32_t) dst & 3)) {
+    *dst++ = *src++;
+    len--;
+  }
+  uint32_t *dst32Bits = (uint32_t *) dst;
+  const uint32_t *src32Bits = (const uint32_t *) src;
+  for (; len >= 4; len -= 4) {
+    *dst32Bits++ = *src32Bits++;
+  }
+  dst = (uint8_t *) dst32Bits;
+  src = (const uint8_t *) src32Bits;
+  while (len--) *dst++ = *src++;
+}
+
 void BlueVGA::waitVSync(uint16_t waitFrames) {
-  uint32_t myNextFrame = frameNumber + waitFrames;
+  uint32_t waitStartCycle = DWT_CYCCNT_REG;
+  uint32_t waitStartFrame = frameNumber;
+  uint32_t myNextFrame = waitStartFrame + waitFrames;
   while (myNextFrame > frameNumber) asm volatile ("wfi");
+
+  // DWT doesn't count while the core sleeps on wfi, thus idle time is the whole period minus busy time
+  uint32_t periodCycles = (frameNumber - lastVSyncFrame) * CYCLES_PER_FRAME;
+  busyCycles = waitStartCycle - lastVSyncCycle;
+  idleCycles = periodCycles > busyCycles ? periodCycles - busyCycles : 0;
+  if (busyCycles > worstBusyCycles) worstBusyCycles = busyCycles;
+  if (waitStartFrame != lastVSyncFrame) {   // frame has already ended before calling waitVSync()
+    uint32_t missedFrames = waitStartFrame - lastVSyncFrame;
+    frameOverruns++;
+    droppedFrames += missedFrames;
+    lastOverrunFrame = waitStartFrame;
+    if (missedFrames > longestStall) longestStall = missedFrames > 0xFFFF ? 0xFFFF : missedFrames;
+  }
+  frameHistory[historyHead].frame = waitStartFrame;
+  frameHistory[historyHead].busyCycles = busyCycles;
+  historyHead = (historyHead + 1) % FRAME_HISTORY_SIZE;
+  if (historyCount < FRAME_HISTORY_SIZE) historyCount++;
+
+  lastVSyncCycle = DWT_CYCCNT_REG;
+  lastVSyncFrame = frameNumber;
+}
+
+uint8_t BlueVGA::getCPUUsage() {
+  uint32_t periodCycles = busyCycles + idleCycles;
+  if (!periodCycles) return 0;
+  if (busyCycles >= periodCycles) return 100;
+  return (uint8_t) (((uint64_t) busyCycles * 100) / periodCycles);
+}
+
+uint8_t BlueVGA::getFrameHistory(frameTimeRecord *records, uint8_t maxRecords) {
+  if (!records) return 0;
+  uint8_t n = maxRecords < historyCount ? maxRecords : historyCount;
+  // oldest of the n most recent records
+  uint8_t idx = (historyHead + FRAME_HISTORY_SIZE - n) % FRAME_HISTORY_SIZE;
+  for (uint8_t i = 0; i < n; i++) {
+    records[i] = frameHistory[idx];
+    idx = (idx + 1) % FRAME_HISTORY_SIZE;
+  }
+  return n;
+}
+
+void BlueVGA::resetFrameStats() {
+#if VGA_MEASURE_ISR
+  isrMaxCycles = 0;
+#endif
+  worstBusyCycles = 0;
+  frameOverruns = 0;
+  droppedFrames = 0;
+  lastOverrunFrame = 0;
+  longestStall = 0;
+  historyHead = 0;
+  historyCount = 0;
+}
+
+#if VGA_MEASURE_ISR
+uint32_t BlueVGA::getISRMaxCycles() {
+  return isrMaxCycles;
 }
 
+uint32_t BlueVGA::getISRFrameCycles() {
+  return isrFrameCycles;
+}
+#endif
+
 uint32_t BlueVGA::getFrameNumber() {
   return frameNumber;
 }
@@ -56,39 +155,56 @@ void BlueVGA::setFontBitmap(const uint8_t *bmap) {
     TBitmap = (uint8_t *)bmap;
     // allow to exchange between Flash Tile Bitmap and RAM Tile Bitmap 
 #ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
-    TIM1->CCR1 = ((uint32_t) bmap) < 0x20000000 ? 40 : 165;
+    TIM1->CCR1 = VIDEO_CCR1(flashFont);
 #endif
 #ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
-    TIMER1_BASE->CCR1 = ((uint32_t) bmap) < 0x20000000 ? 10 : 135;
+    TIMER1_BASE->CCR1 = VIDEO_CCR1(flashFont);
 #endif
   }
 }
 
+#if VGA_MIXED_TILES
+void BlueVGA::setRamTileBank(uint8_t *bank) {
+  if (bank) TBitmapRam = bank;
+}
+#endif
+
+#if VGA_FINE_SCROLL
+void BlueVGA::setScrollX(uint16_t pixelX) {
+  scrollPixelX = pixelX % (VRAM_WIDTH * 8);
+  video_set_scroll(scrollPixelX);
+}
+
+void BlueVGA::setScrollRows(uint8_t firstRow, uint8_t rows) {
+  video_set_scroll_rows(firstRow, rows);
+}
+#endif
+
 void BlueVGA::setBGColor(uint8_t x, uint8_t y, uint8_t c) {
   x = x % VRAM_WIDTH;
   y = y % VRAM_HEIGHT;
-  CRAM[y][x] &= 0x0F;
-  CRAM[y][x] |= (c << 4);
+  CRAM_CELL(y, x) &= 0x0F;
+  CRAM_CELL(y, x) |= (c << 4);
 }
 
 uint8_t BlueVGA::getBGColor(uint8_t x, uint8_t y) {
   x = x % VRAM_WIDTH;
   y = y % VRAM_HEIGHT;
-  return (CRAM[y][x] >> 4);
+  return (CRAM_CELL(y, x) >> 4);
 }
 
 void BlueVGA::setFGColor(uint8_t x, uint8_t y, uint8_t c) {
   x = x % VRAM_WIDTH;
   y = y % VRAM_HEIGHT;
   c = c & 0x0F;
-  CRAM[y][x] &= 0xF0;
-  CRAM[y][x] |= c;
+  CRAM_CELL(y, x) &= 0xF0;
+  CRAM_CELL(y, x) |= c;
 }
 
 uint8_t BlueVGA::getFGColor(uint8_t x, uint8_t y) {
   x = x % VRAM_WIDTH;
   y = y % VRAM_HEIGHT;
-  return (CRAM[y][x] & 0x0F);
+  return (CRAM_CELL(y, x) & 0x0F);
 }
 
 uint8_t BlueVGA::getColorCode (uint8_t cfg, uint8_t cbg) {
@@ -98,16 +214,23 @@ uint8_t BlueVGA::getColorCode (uint8_t cfg, uint8_t cbg) {
 uint8_t BlueVGA::getReversedColorCode (uint8_t x, uint8_t y) {
   x = x % VRAM_WIDTH;
   y = y % VRAM_HEIGHT;
-  uint16_t c = CRAM[y][x];
+  uint16_t c = CRAM_CELL(y, x);
   return ((c << 4) | (c >> 4));
 }
 
 void BlueVGA::setColor(uint8_t x, uint8_t y, uint8_t c) {
   x = x % VRAM_WIDTH;
   y = y % VRAM_HEIGHT;
-  CRAM[y][x] = c;
+  CRAM_CELL(y, x) = c;
 }
 
+#if VGA_TILE_2BPP
+void BlueVGA::setPalette(uint8_t palette, uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3) {
+  const uint8_t colors[4] = {c0, c1, c2, c3};
+  video_set_palette(palette, colors);
+}
+#endif
+
 void BlueVGA::setColorRegion(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t c) {
   x1 = x1 % VRAM_WIDTH;
   y1 = y1 % VRAM_HEIGHT;
@@ -123,10 +246,13 @@ void BlueVGA::setColorRegion(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uin
     y2 = y1;
     y1 = y;
   }
-  for (uint8_t y = y1; y <= y2; y++)
-    for (uint8_t x = x1; x <= x2; x++) {
-      CRAM[y][x] = c;
-    }
+  for (uint8_t y = y1; y <= y2; y++) {
+#if VGA_ROW_COLORS
+    CRAM_CELL(y, x1) = c;
+#else
+    fillRow(&CRAM[y][x1], x2 - x1 + 1, c);
+#endif
+  }
 }
 
 void BlueVGA::setTile(uint8_t x, uint8_t y, uint8_t t) {
@@ -157,14 +283,8 @@ void BlueVGA::setTileRowsFast(uint8_t y1, uint8_t y2, uint8_t tile) {
 
   uint32_t fourTiles = tile | tile << 8 | tile << 16 | tile << 24;
   uint32_t *rowHead = (uint32_t *) TRAM[y1];
-  for (uint8_t i = y1; i <= y2; i++) {
-    // 4 * 7 = 28 tiles per row
-    *rowHead++ = fourTiles;
-    *rowHead++ = fourTiles;
-    *rowHead++ = fourTiles;
-    *rowHead++ = fourTiles;
-    *rowHead++ = fourTiles;
-    *rowHead++ = fourTiles;
+  // rows are contiguous in TRAM, thus it is a single run of VRAM_ROW_WORDS 32 bits words per row
+  for (uint16_t i = (y2 - y1 + 1) * VRAM_ROW_WORDS; i; i--) {
     *rowHead++ = fourTiles;
   }
 }
@@ -175,10 +295,25 @@ void BlueVGA::printStr(uint8_t x, uint8_t y, uint8_t color, char *str) {
     x = x % VRAM_WIDTH;
     y = y % VRAM_HEIGHT;
     if (l > VRAM_WIDTH - x) l = VRAM_WIDTH - x;
-    for (uint8_t p = x; p <= x + l - 1; p++) {
-      TRAM[y][p] = str[p - x] & 0x7F;
-      CRAM[y][p] = color;
+#if VGA_ROW_COLORS
+    CRAM_CELL(y, x) = color;
+#else
+    fillRow(&CRAM[y][x], l, color);
+#endif
+    // same as fillRow(), 4 characters at once in the aligned middle of the row
+    uint8_t *dst = &TRAM[y][x];
+    while (l && ((uint32_t) dst & 3)) {
+      *dst++ = *str++ & 0x7F;
+      l--;
+    }
+    uint32_t *dst32Bits = (uint32_t *) dst;
+    for (; l >= 4; l -= 4, str += 4) {
+      uint32_t fourChars;
+      memcpy(&fourChars, str, 4);         // a single unaligned 32 bits read on Cortex-M3
+      *dst32Bits++ = fourChars & 0x7F7F7F7F;
     }
+    dst = (uint8_t *) dst32Bits;
+    while (l--) *dst++ = *str++ & 0x7F;
   }
 }
 
@@ -206,13 +341,18 @@ void BlueVGA::fillScreen(uint8_t tile) {
 
 
 void BlueVGA::clearScreen(uint8_t color, uint8_t tile) {
-  for (uint8_t y = 0; y < VRAM_HEIGHT; y++)
-    for (uint8_t x = 0; x < VRAM_WIDTH; x++)
-      setTile(x, y, tile, color);  // default: ASCII 32 for space or blank  + default color black on black
+  // default: ASCII 32 for space or blank  + default color black on black
+  // TRAM and CRAM are single runs of 32 bits words - 4 tiles and 4 colors at once
+  setTileRowsFast(0, VRAM_HEIGHT - 1, tile);
+  uint32_t fourColors = color * 0x01010101UL;
+  uint32_t *CRAM32Bits = (uint32_t *) CRAM;
+  for (uint16_t i = VRAM_HEIGHT * CRAM_ROW_WORDS; i; i--) {
+    *CRAM32Bits++ = fourColors;
+  }
 }
 
 
-void BlueVGA::beginVGA(const uint8_t *bmap) {
+void BlueVGA::beginVGA(const uint8_t *bmap, uint8_t color, uint8_t tile) {
 #ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
   systick_disable();
 #endif
@@ -220,11 +360,16 @@ void BlueVGA::beginVGA(const uint8_t *bmap) {
   SysTick->CTRL = 0;    //Disable Systick
 #endif
 
-  // default screen in blue...
-  clearScreen(0x20, 0);
+  // default screen in blue... VRAM is written only here, before video starts, so no garbage is ever displayed
+  clearScreen(color, tile);
   if (bmap) setFontBitmap(bmap);
   else setFontBitmap(defaultTile);  // in case bmap is NULL, use a minimum tile bitmap of 1 default empty tile
+#if VGA_MIXED_TILES
+  if (!TBitmapRam) TBitmapRam = BlueBitmap::ramFont;  // where BlueBitmap draws, unless setRamTileBank() sets another bank
+#endif
   video_init(((uint32_t) bmap) < 0x20000000);
+  lastVSyncCycle = DWT_CYCCNT_REG;
+  lastVSyncFrame = frameNumber;
 }
 
 void BlueVGA::endVGA() {
@@ -239,34 +384,213 @@ BlueVGA::BlueVGA(const uint8_t *bmap) {
   beginVGA(bmap);
 }
 
+BlueVGA::BlueVGA(const uint8_t *bmap, uint8_t color, uint8_t tile) {
+  beginVGA(bmap, color, tile);
+}
+
 BlueVGA::~BlueVGA() {
   endVGA();
 }
 
 
+// Screen snapshots - a run of 3 to 128 equal bytes is coded as (0x80 | length - 1) + byte
+// and 1 to 128 bytes that don't repeat as (length - 1) + bytes
+static uint8_t *rleEncode(const uint8_t *src, uint16_t len, uint8_t *dst, const uint8_t *dstEnd) {
+  uint16_t i = 0;
+  while (i < len) {
+    uint16_t run = 1;
+    while (i + run < len && run < 128 && src[i + run] == src[i]) run++;
+    if (run >= 3) {
+      if (dst + 2 > dstEnd) return NULL;
+      *dst++ = 0x80 | (run - 1);
+      *dst++ = src[i];
+      i += run;
+    } else {
+      // literal bytes up to the next run of 3 or more
+      uint16_t lit = 0;
+      while (i + lit < len && lit < 128 &&
+             !(i + lit + 2 < len && src[i + lit] == src[i + lit + 1] && src[i + lit] == src[i + lit + 2])) lit++;
+      if (dst + lit + 1 > dstEnd) return NULL;
+      *dst++ = lit - 1;
+      memcpy(dst, src + i, lit);
+      dst += lit;
+      i += lit;
+    }
+  }
+  return dst;
+}
+
+// reads an encoded stream in pieces of any size - packets may span more than one piece, such as a layout row
+typedef struct {
+  const uint8_t *src;
+  uint8_t left;           // bytes left in the current packet
+  bool run;
+} rleReader;
+
+static void rleRead(rleReader *r, uint8_t *dst, uint16_t len) {
+  while (len) {
+    if (!r->left) {
+      uint8_t code = *r->src++;
+      r->run = code & 0x80;
+      r->left = (code & 0x7F) + 1;
+    }
+    uint8_t n = len < r->left ? len : r->left;
+    if (r->run) {
+      memset(dst, *r->src, n);
+    } else {
+      memcpy(dst, r->src, n);
+      r->src += n;
+    }
+    r->left -= n;
+    if (r->run && !r->left) r->src++;     // run value is consumed with the last byte of the run
+    dst += n;
+    len -= n;
+  }
+}
+
+uint16_t BlueVGA::saveScreen(uint8_t *buffer, uint16_t bufferSize, const uint8_t *tiles, uint16_t tileBytes) {
+  if (!buffer || bufferSize < 6) return 0;
+  if (!tiles) tileBytes = 0;
+  if (tileBytes > RAM_FONT_TILES * TILE_BYTES) tileBytes = RAM_FONT_TILES * TILE_BYTES;
+  const uint8_t *bufferEnd = buffer + bufferSize;
+  uint8_t *dst = buffer;
+  // the layout of TRAM, CRAM and tiles is part of the header, a snapshot is only restored by the same setting
+  *dst++ = VRAM_WIDTH;
+  *dst++ = VRAM_HEIGHT;
+  *dst++ = CRAM_WIDTH;
+  *dst++ = TILE_BYTES;
+  *dst++ = tileBytes & 0xFF;
+  *dst++ = tileBytes >> 8;
+  dst = rleEncode((uint8_t *) TRAM, sizeof(TRAM), dst, bufferEnd);
+  if (dst) dst = rleEncode((uint8_t *) CRAM, sizeof(CRAM), dst, bufferEnd);
+  if (dst && tileBytes) dst = rleEncode(tiles, tileBytes, dst, bufferEnd);
+  return dst ? dst - buffer : 0;
+}
+
+bool BlueVGA::restoreScreen(const uint8_t *buffer, uint8_t *tiles) {
+  if (!buffer || buffer[0] != VRAM_WIDTH || buffer[1] != VRAM_HEIGHT || buffer[2] != CRAM_WIDTH || buffer[3] != TILE_BYTES) {
+    return false;
+  }
+  uint16_t tileBytes = buffer[4] | buffer[5] << 8;
+  if (tileBytes > RAM_FONT_TILES * TILE_BYTES) tileBytes = RAM_FONT_TILES * TILE_BYTES;
+  rleReader r = {buffer + 6, 0, false};
+  rleRead(&r, (uint8_t *) TRAM, sizeof(TRAM));
+  rleRead(&r, (uint8_t *) CRAM, sizeof(CRAM));
+  if (tileBytes && tiles) rleRead(&r, tiles, tileBytes);
+  return true;
+}
+
+void BlueVGA::drawLayout(const uint8_t *layout) {
+  if (!layout) return;
+  // each block is w, h, x, y + encoded w * h tiles + encoded w * h colors, a block with w = 0 ends the layout
+  while (*layout) {
+    uint8_t w = layout[0], h = layout[1], x = layout[2], y = layout[3];
+    rleReader r = {layout + 4, 0, false};
+    uint8_t row[256];
+    for (uint8_t i = 0; i < h; i++) {
+      rleRead(&r, row, w);
+      // rows out of the screen are decoded but not drawn
+      if (y + i < VRAM_HEIGHT && x < VRAM_WIDTH) memcpy(&TRAM[y + i][x], row, x + w > VRAM_WIDTH ? VRAM_WIDTH - x : w);
+    }
+    for (uint8_t i = 0; i < h; i++) {
+      rleRead(&r, row, w);
+      if (y + i < VRAM_HEIGHT && x < VRAM_WIDTH) {
+#if VGA_ROW_COLORS
+        setColor(x, y + i, row[0]);
+#else
+        memcpy(&CRAM[y + i][x], row, x + w > VRAM_WIDTH ? VRAM_WIDTH - x : w);
+#endif
+      }
+    }
+    layout = r.src;
+  }
+}
+
 // Vertical Scroll manipulation
-void BlueVGA::scrollText(uint8_t lines) {
+void BlueVGA::scrollText(uint8_t lines, uint8_t tile, uint8_t color) {
   if (!lines) return;
-  lines %= VRAM_HEIGHT;
+  if (lines > VRAM_HEIGHT) lines = VRAM_HEIGHT;
   uint32_t *srcT = (uint32_t *)TRAM[lines], *srcC = (uint32_t *)CRAM[lines];  // 32bits at once
   uint32_t *dstT = (uint32_t *)TRAM[0], *dstC = (uint32_t *)CRAM[0];          // 32bits at once
-  for (uint8_t y = lines; y < VRAM_HEIGHT; y++) {
-    // it's faster not using loops
-    *dstT++ = *srcT++; *dstT++ = *srcT++; *dstT++ = *srcT++; *dstT++ = *srcT++;
-    *dstT++ = *srcT++; *dstT++ = *srcT++; *dstT++ = *srcT++;
-    *dstC++ = *srcC++; *dstC++ = *srcC++; *dstC++ = *srcC++; *dstC++ = *srcC++;
-    *dstC++ = *srcC++; *dstC++ = *srcC++; *dstC++ = *srcC++;
+  // rows are contiguous, thus all remaining rows are moved as a single run of 32 bits words
+  for (uint16_t i = (VRAM_HEIGHT - lines) * VRAM_ROW_WORDS; i; i--) {
+    *dstT++ = *srcT++;
+  }
+  for (uint16_t i = (VRAM_HEIGHT - lines) * CRAM_ROW_WORDS; i; i--) {
+    *dstC++ = *srcC++;
+  }
+  // new lines at the bottom get tile and color, no stale colors from the rows that moved up
+  uint32_t fourTiles = tile * 0x01010101UL, fourColors = color * 0x01010101UL;
+  for (uint16_t i = lines * VRAM_ROW_WORDS; i; i--) {
+    *dstT++ = fourTiles;
+  }
+  for (uint16_t i = lines * CRAM_ROW_WORDS; i; i--) {
+    *dstC++ = fourColors;
+  }
+}
+
+void BlueVGA::scrollTextDown(uint8_t lines, uint8_t tile, uint8_t color) {
+  if (!lines) return;
+  if (lines > VRAM_HEIGHT) lines = VRAM_HEIGHT;
+  // same as scrollText() from the end of VRAM backwards, thus rows are not overwritten before being moved
+  uint32_t *srcT = (uint32_t *)TRAM[VRAM_HEIGHT - lines], *srcC = (uint32_t *)CRAM[VRAM_HEIGHT - lines];
+  uint32_t *dstT = (uint32_t *)TRAM[VRAM_HEIGHT], *dstC = (uint32_t *)CRAM[VRAM_HEIGHT];
+  for (uint16_t i = (VRAM_HEIGHT - lines) * VRAM_ROW_WORDS; i; i--) {
+    *--dstT = *--srcT;
+  }
+  for (uint16_t i = (VRAM_HEIGHT - lines) * CRAM_ROW_WORDS; i; i--) {
+    *--dstC = *--srcC;
   }
-//  uint8_t dstColor1 = ((bgColor << 4) | (fgColor & 0x0F));
-//  uint32_t dstColor4 = dstColor1;                                             // 32bits at once
-//  dstColor4 = (dstColor4 << 8) | dstColor1;
-//  dstColor4 = (dstColor4 << 8) | dstColor1;
-//  dstColor4 = (dstColor4 << 8) | dstColor1;
-  for (uint8_t y = 0; y < lines; y++) {                                         // fill last line with ' ' (space char) not modifying previous fg/bg colors
-    *dstT++ = 0x20202020; *dstT++ = 0x20202020; *dstT++ = 0x20202020; *dstT++ = 0x20202020;
-    *dstT++ = 0x20202020; *dstT++ = 0x20202020; *dstT++ = 0x20202020;
-//    *dstC++ = dstColor4;  *dstC++ = dstColor4;  *dstC++ = dstColor4;  *dstC++ = dstColor4;
-//    *dstC++ = dstColor4;  *dstC++ = dstColor4;  *dstC++ = dstColor4;
+  uint32_t fourTiles = tile * 0x01010101UL, fourColors = color * 0x01010101UL;
+  for (uint16_t i = lines * VRAM_ROW_WORDS; i; i--) {
+    *--dstT = fourTiles;
+  }
+  for (uint16_t i = lines * CRAM_ROW_WORDS; i; i--) {
+    *--dstC = fourColors;
+  }
+}
+
+// Horizontal Scroll manipulation - columns < 0 scroll the text to the left, columns > 0 to the right
+void BlueVGA::scrollTextColumns(int8_t columns, uint8_t tile, uint8_t color) {
+  if (!columns) return;
+  uint8_t n = columns < 0 ? -columns : columns;
+  if (n > VRAM_WIDTH) n = VRAM_WIDTH;
+  uint8_t from = columns < 0 ? n : 0, to = columns < 0 ? 0 : n;            // where the kept columns come from and go
+  uint8_t freed = columns < 0 ? VRAM_WIDTH - n : 0;                        // first of the new columns
+  for (uint8_t y = 0; y < VRAM_HEIGHT; y++) {
+    // source and destination overlap and are only word aligned when n is multiple of 4, memmove() takes care of both
+    memmove(&TRAM[y][to], &TRAM[y][from], VRAM_WIDTH - n);
+    fillRow(&TRAM[y][freed], n, tile);
+#if !VGA_ROW_COLORS
+    memmove(&CRAM[y][to], &CRAM[y][from], VRAM_WIDTH - n);
+    fillRow(&CRAM[y][freed], n, color);
+#endif
+  }
+}
+
+void BlueVGA::scrollRegion(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t lines, uint8_t tile, uint8_t color) {
+  if (x >= VRAM_WIDTH || y >= VRAM_HEIGHT || !w || !h) return;
+  if (w > VRAM_WIDTH - x) w = VRAM_WIDTH - x;
+  if (h > VRAM_HEIGHT - y) h = VRAM_HEIGHT - y;
+  if (lines > h) lines = h;
+
+  // only the columns of the region are moved, row by row from the top
+  uint8_t row = y;
+  for (; row < y + h - lines; row++) {
+    copyRow(&TRAM[row][x], &TRAM[row + lines][x], w);
+#if VGA_ROW_COLORS
+    CRAM_CELL(row, x) = CRAM_CELL(row + lines, x);
+#else
+    copyRow(&CRAM[row][x], &CRAM[row + lines][x], w);
+#endif
+  }
+  for (; row < y + h; row++) {
+    fillRow(&TRAM[row][x], w, tile);
+#if VGA_ROW_COLORS
+    CRAM_CELL(row, x) = color;
+#else
+    fillRow(&CRAM[row][x], w, color);
+#endif
   }
 }
 
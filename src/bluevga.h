@@ -33,6 +33,15 @@
 #include "vgaProperties.h"
 #include "Print.h"
 
+// worst case size of a saveScreen() snapshot - a 6 bytes header and 1 extra byte for each 128 bytes of incompressible data
+#define SCREEN_SNAPSHOT_MAX_SIZE(tileBytes)   (6 + (VRAM_HEIGHT * (VRAM_WIDTH + CRAM_WIDTH) + (tileBytes)) * 129 / 128 + 3)
+
+// one entry of the frame time history - returned by BlueVGA::getFrameHistory()
+typedef struct {
+  uint32_t frame;          // frameNumber when waitVSync() was called
+  uint32_t busyCycles;     // cycles taken by the sketch before this call - more than CYCLES_PER_FRAME means it overran
+} frameTimeRecord;
+
 class BlueVGA : public Print{
 
   private:
@@ -43,6 +52,22 @@ class BlueVGA : public Print{
     bool wrap = true;                 // define if print beyond right screen margin will coninue on next line
     uint8_t fgColor = RGB_YELLOW, bgColor = RGB_BLUE;          // colors for foreground and cackground when printing
     uint8_t textTabSize = 4;         // default set TAB in 4 spaces
+#if VGA_FINE_SCROLL
+    uint16_t scrollPixelX = 0;        // last value of setScrollX()
+#endif
+
+    // frame time accounting - updated on every waitVSync() call
+    uint32_t lastVSyncCycle = 0;      // DWT cycle counter when waitVSync() last returned
+    uint32_t lastVSyncFrame = 0;      // frameNumber when waitVSync() last returned
+    uint32_t busyCycles = 0;          // cycles spent by the sketch between the last two waitVSync() calls
+    uint32_t idleCycles = 0;          // cycles spent waiting for VSync in the last waitVSync() call
+    uint32_t worstBusyCycles = 0;     // longest busy time measured since last resetFrameStats()
+    uint32_t frameOverruns = 0;       // number of times the sketch could not finish its work within the frame
+    uint32_t droppedFrames = 0;       // total number of frames missed because of overruns
+    uint32_t lastOverrunFrame = 0;    // frameNumber of the last overrun
+    uint16_t longestStall = 0;        // largest number of frames missed by a single overrun
+    uint8_t historyHead = 0, historyCount = 0;
+    frameTimeRecord frameHistory[FRAME_HISTORY_SIZE];   // ring buffer with the most recent frame times
     
   public:
 #ifdef ARDUINO_ARCH_STM32  // Arduino_Core_STM32 Core https://github.com/stm32duino/Arduino_Core_STM32
@@ -59,6 +84,9 @@ class BlueVGA : public Print{
     // constructors and destructor
     BlueVGA(const uint8_t *bmap);
     BlueVGA();
+    // the screen starts filled with tile and color, thus the sketch doesn't need to clear it again in setup()
+    // such as BlueVGA vga(ASCII_FONT, RGB_WHITE | RGB_BLACK << 4) or BlueVGA vga(USE_RAM, RGB_WHITE | RGB_BLACK << 4, 0)
+    BlueVGA(const uint8_t *bmap, uint8_t color, uint8_t tile = ' ');
     ~BlueVGA();
 
     /*
@@ -96,7 +124,29 @@ class BlueVGA : public Print{
         textTabSize = t; 
     }
 
-    void scrollText(uint8_t lines = 1);
+    // scrolls up the whole screen, new lines at the bottom are ' ' using current text colors
+    inline void scrollText(uint8_t lines = 1) {
+        scrollText(lines, ' ', getTextColor());
+    }
+    // scrolls up the whole screen, new lines at the bottom get tile and color (BG << 4 | FG) - all 32 bits copies
+    void scrollText(uint8_t lines, uint8_t tile, uint8_t color);
+    // same as scrollText() the other way, new lines at the top get tile and color
+    inline void scrollTextDown(uint8_t lines = 1) {
+        scrollTextDown(lines, ' ', getTextColor());
+    }
+    void scrollTextDown(uint8_t lines, uint8_t tile, uint8_t color);
+    // scrolls the whole screen sideways, columns < 0 to the left and > 0 to the right - new columns get tile and color,
+    // or ' ' using current text colors. With VGA_ROW_COLORS the colors of the rows are kept and color is not used
+    inline void scrollTextColumns(int8_t columns) {
+        scrollTextColumns(columns, ' ', getTextColor());
+    }
+    void scrollTextColumns(int8_t columns, uint8_t tile, uint8_t color);
+    // scrolls up only the w x h tiles rectangle at x,y - new rows at its bottom get tile and color (BG << 4 | FG)
+    // the rest of the screen is not touched, thus a fixed header or status line stays on the screen (see BlueConsole)
+    inline void scrollRegion(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t lines = 1) {
+        scrollRegion(x, y, w, h, lines, ' ', getTextColor());
+    }
+    void scrollRegion(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t lines, uint8_t tile, uint8_t color);
 
 
     /*
@@ -109,8 +159,64 @@ class BlueVGA : public Print{
     uint32_t getFrameNumber();                  // it returns a Frame Sequenced Number
     uint32_t getScanLineNumber();               // it returns the ScanLine Sequenced Number - each scanline takes 31.7775 microseconds and it can help to count time
 
+    /*
+       Frame time accounting. Every call to waitVSync() measures, using the DWT cycle counter, how many CPU cycles
+       the sketch spent since the previous waitVSync() returned (busy time) and how long it then waited for VSync (idle time).
+       A frame has CYCLES_PER_FRAME (1201200) cycles at 72MHz. Busy time also includes the cycles taken by the VGA interrupt.
+       The core sleeps (wfi) while waiting, thus idle time is derived from the number of frames waited instead of counted.
+       A frame overrun happens when the sketch is still busy when the VGA frame it was supposed to fit in ends.
+       This means waitVSync() was called after frameNumber had already moved, thus at least one frame was dropped.
+       The last FRAME_HISTORY_SIZE measurements are kept and can be read with getFrameHistory() to find out which frames overran.
+       Call resetFrameStats() at the end of setup() in order to discard the time taken by initialization.
+    */
+    inline uint32_t getBusyCycles() {
+        return busyCycles;
+    }
+    inline uint32_t getIdleCycles() {
+        return idleCycles;
+    }
+    inline uint32_t getWorstFrameTime() {       // in CPU cycles - divide by 72 for microseconds
+        return worstBusyCycles;
+    }
+    inline uint32_t getFrameOverruns() {
+        return frameOverruns;
+    }
+    inline uint32_t getDroppedFrames() {
+        return droppedFrames;
+    }
+    inline uint16_t getLongestStall() {         // in frames
+        return longestStall;
+    }
+    inline uint32_t getLastOverrunFrame() {
+        return lastOverrunFrame;
+    }
+    // copies up to maxRecords of the most recent frame times, oldest first, and returns the number of records copied
+    uint8_t getFrameHistory(frameTimeRecord *records, uint8_t maxRecords = FRAME_HISTORY_SIZE);
+    uint8_t getCPUUsage();                      // percentage of the last waitVSync() period used by the sketch (0 to 100)
+    void resetFrameStats();
+#if VGA_MEASURE_ISR
+    // VGA interrupt time, measured with the DWT cycle counter - compiled only with VGA_MEASURE_ISR (see vgaProperties.h)
+    uint32_t getISRMaxCycles();                 // longest scanline interrupt since last resetFrameStats()
+    uint32_t getISRFrameCycles();               // cycles taken by the VGA interrupt in the last whole frame
+#endif
+
     // allows to set the bitmap used to draw tiles in the screen...
     void setFontBitmap(const uint8_t *bmap);
+#if VGA_MIXED_TILES
+    // sets the bitmap of tiles 128..255, indexed by the whole tile number - BlueBitmap::ramFont by default
+    // tiles 0..127 keep using the bitmap of setFontBitmap() - compiled only with VGA_MIXED_TILES (see vgaProperties.h)
+    void setRamTileBank(uint8_t *bank);
+#endif
+#if VGA_FINE_SCROLL
+    // shows the screen from pixel column pixelX of TRAM/CRAM on, any value from 0 to VRAM_WIDTH * 8 - 1, and tiles that
+    // leave the screen on the left come back on the right - compiled only with VGA_FINE_SCROLL (see vgaProperties.h)
+    void setScrollX(uint16_t pixelX);
+    inline uint16_t getScrollX() {
+        return scrollPixelX;
+    }
+    // only rows firstRow to firstRow + rows - 1 scroll, the other ones stay fixed, as a score or status line
+    void setScrollRows(uint8_t firstRow = 0, uint8_t rows = VRAM_HEIGHT);
+#endif
 
     /*
        The display has 28x30 tiles that can use 2 colors each. Foreground color for pixels "1" ans background color for pixels "0"
@@ -118,6 +224,7 @@ class BlueVGA : public Print{
        Each background and foreground color is 3 bpp (bits per pixel) and is structures as RGB0 - 1 bits for Red, 1 for Green and 1 for Blue and a last bit zero
        It's possible to use all those 8 color in the screen at the same time.
        Painting BG and FG colors are done at x,y related to a 28x30 coordinate tile system.
+       When compiled with VGA_ROW_COLORS (see vgaProperties.h), all tiles of a row share the same colors, thus painting any tile paints its whole row.
     */
     void setFGColor(uint8_t x, uint8_t y, uint8_t cfg);   // paints foreground color of tile at x,y with color C in format RGB0 (4 bits)
     uint8_t getFGColor(uint8_t x, uint8_t y);             // gets the foreground color of tile at x,y
@@ -128,6 +235,10 @@ class BlueVGA : public Print{
     uint8_t getReversedColorCode (uint8_t x, uint8_t y);  // helper function for returning a single 8 bits color that swaps Back and Foreground color of a Tile
     void setColor(uint8_t x, uint8_t y, uint8_t color);   // helper function for setting a Back and Foreground color of a Tile with a single 8 bits color
     void setColorRegion(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color); // helper function for setting the BG+FG color of a region of the screen
+#if VGA_TILE_2BPP
+    // with 2bpp tiles, the color of a tile (setColor) is the number of its palette and each palette has 4 RGB0 colors
+    void setPalette(uint8_t palette, uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3);
+#endif
 
     /*
        The display has 28x30 tiles that can use 2 colors each. Foreground color for pixels "1" ans background color for pixels "0"
@@ -155,6 +266,28 @@ class BlueVGA : public Print{
     // Helper functions for clearing the screen by copying a ' ' (blank character ASCII code 0x20) on every place of the screen
     void clearScreen(uint8_t color = 0, uint8_t tile = ' ');
 
+    /*
+        Screen snapshots - saveScreen() run-length encodes TRAM and CRAM into buffer and returns the number of bytes used,
+        or 0 when it doesn't fit in bufferSize. restoreScreen() decodes it back in a fraction of a frame, thus a whole menu
+        page can be switched at once, after waitVSync(), instead of being redrawn with many printStr() calls.
+        Optionally it also saves tileBytes bytes of a RAM tile bitmap, such as the used part of BlueBitmap::ramFont:
+            vga.saveScreen(page1, sizeof(page1), BlueBitmap::ramFont, BlueBitmap::getNextFreeTile() * TILE_BYTES);
+            vga.restoreScreen(page1, BlueBitmap::ramFont);
+        A text screen with few colors usually takes a few hundred bytes. The worst case is SCREEN_SNAPSHOT_MAX_SIZE(tileBytes).
+    */
+    uint16_t saveScreen(uint8_t *buffer, uint16_t bufferSize, const uint8_t *tiles = NULL, uint16_t tileBytes = 0);
+    // false if the snapshot is from another screen size, VGA_ROW_COLORS or VGA_TILE_2BPP setting
+    // tileBytes is limited to the size of BlueBitmap::ramFont (RAM_FONT_TILES * TILE_BYTES) when saving and restoring
+    bool restoreScreen(const uint8_t *buffer, uint8_t *tiles = NULL);
+
+    /*
+        Screen layouts - precompiled rectangles of tiles and colors, usually kept in flash, drawn with a single call.
+        A layout is a list of blocks: w, h, x, y (in tiles) followed by the w * h tiles and the w * h colors, row by row,
+        both encoded as in saveScreen(). A block with w = 0 ends the layout.
+        tools/layout_compiler.py converts a text or PNG mockup into a layout C array.
+    */
+    void drawLayout(const uint8_t *layout);
+
     /*
         beginVGA starts VGA sginaling of Bluepill
         it uses pins PA9 as Horizontal Sync VGA signal
@@ -169,7 +302,7 @@ class BlueVGA : public Print{
                            or use getFrameNumber() to know number of Frames since sketch started execution in 1/60 second units ==> 16.66 milliseconds
 
     */
-    void beginVGA(const uint8_t *bmap = NULL);
+    void beginVGA(const uint8_t *bmap = NULL, uint8_t color = 0x20, uint8_t tile = 0);
     void endVGA();
 
 };
@@ -55,26 +55,257 @@
 
 #include "bluevgadriver.h"
 
+// Cortex-M3 debug registers used to enable the DWT cycle counter - same address on both cores
+#define DEMCR_REG     (*(volatile uint32_t *)0xE000EDFC)
+#define DWT_CTRL_REG  (*(volatile uint32_t *)0xE0001000)
+
 volatile uint32_t frameNumber = 0;
 volatile uint32_t scanLineCounter = 0;
 
 uint8_t TRAM [VRAM_HEIGHT][VRAM_WIDTH] __attribute__((aligned(32))); // VRAM with static Tiles of 8 x 8 pixels
-uint8_t CRAM [VRAM_HEIGHT][VRAM_WIDTH] __attribute__((aligned(32))); // Color VRAM - 8 + 8 colors = 4bits + 4bits (Foreground + Background)
+uint8_t CRAM [VRAM_HEIGHT][CRAM_WIDTH] __attribute__((aligned(32))); // Color VRAM - 8 + 8 colors = 4bits + 4bits (Foreground + Background)
 
 uint8_t *TBitmap;
+#if VGA_MIXED_TILES
+uint8_t *TBitmapRam;      // bitmap of tiles 128..255, indexed by the whole tile number as TBitmap
+#endif
+
+#if VGA_MEASURE_ISR
+volatile uint32_t isrMaxCycles = 0;
+volatile uint32_t isrFrameCycles = 0;
+#endif
+
+// input capture - sampled in sendScanLine() and read by the sketch through input_capture_read()
+static volatile uint32_t * volatile inputIDR0 = 0, * volatile inputIDR1 = 0;
+static uint16_t inputMask0, inputMask1;
+static uint16_t inputLines, inputCountdown;
+static uint32_t inputLastState;
+static inputEvent inputQueue[INPUT_EVENT_QUEUE_SIZE];
+static volatile uint8_t inputHead = 0, inputTail = 0;
 
 void sendScanLine(void) __attribute__((aligned(32)));
+
+#define ASM_STR(x)    #x
+#define ASM_NUM(x)    ASM_STR(x)
+#define ASM_NOPS(n)   ".rept " ASM_NUM(n) "\n\t  nop\n\t.endr\n\t"
+
+#if VGA_LINE_BUFFER
+
+// two pixel lines: one is sent while the next one is expanded
+#if VGA_FINE_SCROLL
+// one more tile for the pixels that enter the screen from the right when the scroll is not multiple of 8
+static uint8_t lineBuffer[2][(VRAM_WIDTH + 1) * TILE_W] __attribute__((aligned(32)));
+#else
+static uint8_t lineBuffer[2][VRAM_WIDTH * TILE_W] __attribute__((aligned(32)));
+#endif
+
+// 4 pixels of a tile bitmap nibble to a byte mask each - leftmost pixel (bit 3) goes to the lowest byte as it is sent first
+// these tables are in RAM because flash wait states would slow down the expansion
+static uint32_t nibbleMask[16] = {
+  0x00000000, 0xFF000000, 0x00FF0000, 0xFFFF0000, 0x0000FF00, 0xFF00FF00, 0x00FFFF00, 0xFFFFFF00,
+  0x000000FF, 0xFF0000FF, 0x00FF00FF, 0xFFFF00FF, 0x0000FFFF, 0xFF00FFFF, 0x00FFFFFF, 0xFFFFFFFF
+};
+// RGB0 color to 4 pixels - RGB goes to bits 7-5, which are written to PC15-PC13 when the byte is stored on ODR
+static uint32_t colorPixels[16] = {
+  0x00000000, 0x10101010, 0x20202020, 0x30303030, 0x40404040, 0x50505050, 0x60606060, 0x70707070,
+  0x80808080, 0x90909090, 0xA0A0A0A0, 0xB0B0B0B0, 0xC0C0C0C0, 0xD0D0D0D0, 0xE0E0E0E0, 0xF0F0F0F0
+};
+
+#if VGA_TILE_2BPP
+// a pair of 2bpp pixels (4 bits) to 2 port bytes, left pixel in the lowest byte - one table for each palette
+static uint16_t palettePixels[VGA_PALETTES][16];
+
+void video_set_palette(uint8_t palette, const uint8_t *colors) {
+  uint16_t *pair = palettePixels[palette % VGA_PALETTES];
+  for (uint8_t n = 0; n < 16; n++) {
+    pair[n] = ((colors[n >> 2] & 0x0F) << 4) | ((colors[n & 3] & 0x0F) << 12);
+  }
+}
+
+// expands a pixel line of TRAM/CRAM into port bytes, 8 per tile
+static void __attribute__((optimize("O3"))) buildLine(uint8_t *pixels, uint8_t linePixel) {
+  const uint8_t *tiles = TRAM[linePixel >> 3];
+  const uint8_t *colors = CRAM[linePixel >> 3];
+  const uint16_t *bitmap = (const uint16_t *) (TBitmap + ((linePixel & 7) << 1));
+  uint32_t *dst = (uint32_t *) pixels;
+#if VGA_ROW_COLORS
+  const uint16_t *pair = palettePixels[colors[0] % VGA_PALETTES];
+#endif
+
+  for (uint8_t x = 0; x < VRAM_WIDTH; x++) {
+    uint16_t bits = bitmap[tiles[x] << 3];      // 8 halfwords per tile, first byte has the 4 leftmost pixels
+#if !VGA_ROW_COLORS
+    const uint16_t *pair = palettePixels[colors[x] % VGA_PALETTES];
+#endif
+    *dst++ = pair[(bits >> 4) & 0x0F] | (pair[bits & 0x0F] << 16);
+    *dst++ = pair[bits >> 12] | (pair[(bits >> 8) & 0x0F] << 16);
+  }
+}
+#else
+#if VGA_FRAME_WINDOW
+// volatile: the stores are ordered as written, thus buildLine() never sees a buffer with the geometry of another one
+static const uint8_t * volatile windowBuffer = 0;
+static volatile uint8_t windowX, windowWidth, windowTop, windowLines;
+
+void video_set_window(const uint8_t *buffer, uint8_t tileX, uint8_t tileY, uint8_t tilesW, uint8_t tilesH) {
+  windowBuffer = 0;     // hides the window while it is changed
+  if (tileX >= VRAM_WIDTH || tileY >= VRAM_HEIGHT) return;
+  windowX = tileX;
+  windowWidth = tileX + tilesW > VRAM_WIDTH ? VRAM_WIDTH - tileX : tilesW;
+  windowTop = tileY * TILE_H;
+  windowLines = (tileY + tilesH > VRAM_HEIGHT ? VRAM_HEIGHT - tileY : tilesH) * TILE_H;
+  windowBuffer = buffer;
+}
+#endif
+
+#if VGA_FINE_SCROLL
+static volatile uint16_t scrollX = 0;                      // pixel column of TRAM shown at the left border
+static volatile uint8_t scrollTop = 0, scrollRows = VRAM_HEIGHT;
+static uint8_t pendingShift = 0;                           // pixels to drop from the line built by buildLine()
+
+void video_set_scroll(uint16_t pixelX) {
+  scrollX = pixelX % (VRAM_WIDTH * TILE_W);
+}
+
+void video_set_scroll_rows(uint8_t firstRow, uint8_t rows) {
+  scrollRows = 0;       // no row scrolls while it is changed
+  scrollTop = firstRow;
+  scrollRows = rows;
+}
+
+// second half of a scrolled line: shifts the pixels built by buildLine() to the left by the fine scroll offset
+// the whole bytes are dropped with 32 bits shifts, since lineOut() must read aligned words to keep its timing
+static void __attribute__((optimize("O3"))) alignLine(uint8_t *pixels) {
+  uint8_t shift = pendingShift;
+  if (!shift) return;
+  pendingShift = 0;
+  uint32_t *dst = (uint32_t *) pixels;
+  const uint32_t *src = dst + (shift >> 2);
+  uint8_t right = (shift & 3) << 3, left = 32 - right;
+  uint32_t word = *src++;
+
+  if (!right) {
+    for (uint8_t i = VRAM_WIDTH * 2; i; i--) {
+      *dst++ = word;
+      word = *src++;
+    }
+    return;
+  }
+  for (uint8_t i = VRAM_WIDTH * 2; i; i--) {
+    uint32_t next = *src++;
+    *dst++ = (word >> right) | (next << left);
+    word = next;
+  }
+}
+#endif
+
+// expands a pixel line of TRAM/CRAM into port bytes, 8 per tile
+static void __attribute__((optimize("O3"))) buildLine(uint8_t *pixels, uint8_t linePixel) {
+  const uint8_t *tiles = TRAM[linePixel >> 3];
+  const uint8_t *colors = CRAM[linePixel >> 3];
+#if VGA_MIXED_TILES
+  // bit 7 of the tile number selects the bank - it is read here, far from the scanline, so Flash tiles cost no pixel time
+  const uint8_t *bank[2] = {TBitmap + (linePixel & 7), TBitmapRam + (linePixel & 7)};
+#define TILE_LINE(tile)   bank[(tile) >> 7][(tile) << 3]
+#else
+  const uint8_t *bitmap = TBitmap + (linePixel & 7);
+#define TILE_LINE(tile)   bitmap[(tile) << 3]
+#endif
+  uint32_t *dst = (uint32_t *) pixels;
+#if VGA_FRAME_WINDOW
+  // frame buffer bytes of this line, indexed by tile column
+  const uint8_t *frame = 0;
+  const uint8_t *window = windowBuffer;
+  uint8_t winX = windowX, winWidth = windowWidth;   // read once, not on every tile
+  if (window && (uint8_t)(linePixel - windowTop) < windowLines) {
+    frame = window + (linePixel - windowTop) * winWidth - winX;
+  }
+#endif
+#if VGA_ROW_COLORS
+  uint32_t bg = colorPixels[colors[0] >> 4];
+  uint32_t fgXorBg = colorPixels[colors[0] & 0x0F] ^ bg;
+#endif
+
+#if VGA_FINE_SCROLL
+  // scrolled rows start at the scroll column, wrap around the row and expand one more tile for alignLine()
+  uint8_t x = 0, n = VRAM_WIDTH;
+  uint16_t scroll = scrollX;       // read once, the sketch may change it meanwhile
+  if ((uint8_t)((linePixel >> 3) - scrollTop) < scrollRows) {
+    x = scroll >> 3;
+    n = VRAM_WIDTH + 1;
+    pendingShift = scroll & 7;
+  }
+  for (; n; n--, x = x == VRAM_WIDTH - 1 ? 0 : x + 1) {
+#else
+  for (uint8_t x = 0; x < VRAM_WIDTH; x++) {
+#endif
+#if VGA_FRAME_WINDOW
+    uint8_t bits = frame && (uint8_t)(x - winX) < winWidth ? frame[x] : TILE_LINE(tiles[x]);
+#else
+    uint8_t bits = TILE_LINE(tiles[x]);
+#endif
+#if !VGA_ROW_COLORS
+    uint32_t bg = colorPixels[colors[x] >> 4];
+    uint32_t fgXorBg = colorPixels[colors[x] & 0x0F] ^ bg;
+#endif
+    *dst++ = bg ^ (fgXorBg & nibbleMask[bits >> 4]);
+    *dst++ = bg ^ (fgXorBg & nibbleMask[bits & 0x0F]);
+  }
+#undef TILE_LINE
+}
+#endif
+
+// sends a line built by buildLine() - one pixel each VGA_PIXEL_CYCLES cycles, 4 pixels for each 32 bits read
+void lineOut(const uint8_t *pixels, const uint8_t *gpio) __attribute__((aligned(32)));
+void lineOut(const uint8_t *pixels, const uint8_t *gpio) {
+  asm volatile (
+    ".rept " ASM_NUM(VRAM_WIDTH * 2) "\n\t"
+    "  ldr r5, [%0], #4            \n\t"
+    "  lsr r6, r5, #8              \n\t"
+    ASM_NOPS(VGA_PIXEL_CYCLES - 4)
+    "  strb r5, [%1]               \n\t"
+    "  lsr r7, r5, #16             \n\t"
+    ASM_NOPS(VGA_PIXEL_CYCLES - 2)
+    "  strb r6, [%1]               \n\t"
+    "  lsr r8, r5, #24             \n\t"
+    ASM_NOPS(VGA_PIXEL_CYCLES - 2)
+    "  strb r7, [%1]               \n\t"
+    ASM_NOPS(VGA_PIXEL_CYCLES - 1)
+    "  strb r8, [%1]               \n\t"
+    ".endr                         \n\t"
+    "  mov r5, #0                  \n\t"
+    ASM_NOPS(VGA_PIXEL_CYCLES - 1)
+    "  strb r5, [%1]               \n\t"
+    : "+r" (pixels)
+    : "r" (gpio)
+    : "r5", "r6", "r7", "r8", "memory"
+  );
+}
+
+#else
+
 void scanLine(uint8_t *Tiles, uint8_t *Colors, const uint8_t *Bitmap, const uint8_t *gpio, uint8_t *Buffer) __attribute__((aligned(32)));
 
 
-// function size 4480
+// scanLine() is assembled for the selected VGA_PROFILE - each pixel is sent with "strb r6, [r3]"
+#define PIXEL_OUT     "  strb r6, [r3]               \n\t" ASM_NOPS(VGA_PIXEL_PAD)
+// r9 holds the colors of 4 tiles, one per byte, or just the row color that is used by all tiles
+#if VGA_ROW_COLORS
+#define COLOR_LOAD    "  ldrb r9, [r7]               \n\t"
+#define COLOR_NEXT    "  nop                         \n\t"
+#else
+#define COLOR_LOAD    "  ldr r9, [r7], #4            \n\t"
+#define COLOR_NEXT    "  ror r9, r9, #8              \n\t"
+#endif
+
+// function size 4480 (VGA_PROFILE_28x30)
 void scanLine(uint8_t *Tiles, uint8_t *Colors, const uint8_t *Bitmap, const uint8_t *gpio, uint8_t *Buffer) {
   // assembly for sending the scanline to VGA Monitor using the 3 most significant bits for Red, Green and Blue
   asm volatile (
     "  mov r6, r0                  \n\t"
     "  mov r7, r2                  \n\t"
     "  mov r8, r4                  \n\t"
-    ".rept 28                      \n\t"
+    ".rept " ASM_NUM(VRAM_WIDTH) "\n\t"
     "  ldrb r5, [r6], #1           \n\t"
     "  ldrb r9, [r7, r5, LSL#3]    \n\t"
     "  strb r9, [r8], #1           \n\t"
@@ -82,85 +313,85 @@ void scanLine(uint8_t *Tiles, uint8_t *Colors, const uint8_t *Bitmap, const uint
     "  mov r8, r4                  \n\t"
     "  mov r7, r1                  \n\t"
     "  ldr r5, [r8], #4            \n\t"
-    "  ldr r9, [r7], #4            \n\t"
-    ".rept 7                       \n\t"
+    COLOR_LOAD
+    ".rept " ASM_NUM(VRAM_ROW_WORDS) "\n\t"
     "  ror r5, r5, #5              \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".rept 7                       \n\t"
     "  nop                         \n\t"
     "  ror r5, r5, #31             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".endr                         \n\t"
-    "  ror r9, r9, #8              \n\t"
+    COLOR_NEXT
     "  ror r5, r5, #15             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".rept 7                       \n\t"
     "  nop                         \n\t"
     "  ror r5, r5, #31             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".endr                         \n\t"
     "  ror r5, r5, #15             \n\t"
-    "  ror r9, r9, #8              \n\t"
+    COLOR_NEXT
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".rept 7                       \n\t"
     "  nop                         \n\t"
     "  ror r5, r5, #31             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".endr                         \n\t"
-    "  ror r9, r9, #8              \n\t"
+    COLOR_NEXT
     "  ror r5, r5, #15             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".rept 3                       \n\t"
     "  nop                         \n\t"
     "  ror r5, r5, #31             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     ".endr                         \n\t"
     "  ror r5, r5, #31             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  ror r5, r5, #31             \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     "  ldr r0, [r8], #4            \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     "  ror r5, r5, #31             \n\t"
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
     "  ror r5, r5, #31             \n\t"
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     "  and r6, r5, #4              \n\t"
     "  lsl r6, r9, r6              \n\t"
-    "  ldr r9, [r7], #4            \n\t"
+    COLOR_LOAD
     "  nop                         \n\t"
-    "  strb r6, [r3]               \n\t"
+    PIXEL_OUT
     "  mov r5, r0                  \n\t"
     ".endr                         \n\t"
     "  nop                         \n\t"
@@ -176,28 +407,95 @@ void scanLine(uint8_t *Tiles, uint8_t *Colors, const uint8_t *Bitmap, const uint
   );
 }
 
-// This is the main horizontal sweep - designed to display 224x240 pixels, 8 colors (3bpp) on a VGA 640x480@60Hz signal, Red (PC15) Green(PC14) Blue(PC13)
+#endif
+
+// This is the main horizontal sweep - designed to display 224x240 pixels (VGA_PROFILE_28x30), 8 colors (3bpp) on a VGA 640x480@60Hz signal, Red (PC15) Green(PC14) Blue(PC13)
 void __attribute__((optimize("O3"))) sendScanLine(void) {
+#if VGA_MEASURE_ISR
+  uint32_t isrStartCycle = DWT_CYCCNT_REG;
+  static uint32_t isrCycles = 0;
+#endif
 
   static uint8_t linePixel = 0;
+  static uint8_t lineRepeat = 0;
   static uint8_t videoOn = 0;
-  static uint8_t bitmap[VRAM_WIDTH] __attribute__((aligned(32)));
   const uint8_t *GPIO __attribute__((aligned(32))) = (uint8_t*)(&(GPIOC_REG)->ODR);
+#if VGA_LINE_BUFFER
+  static uint8_t shownBuffer = 0;
+
+  if (videoOn) lineOut(lineBuffer[shownBuffer], GPIO);
+#else
+  static uint8_t bitmap[VRAM_WIDTH] __attribute__((aligned(32)));
 
   if (videoOn) scanLine(TRAM[linePixel >> 3], CRAM[linePixel >> 3], TBitmap + (linePixel & 7), GPIO, bitmap);
+#endif
 
   scanLineCounter++; // scanLineCounter increments every 1/(525*60) = 31.75 us @ 31.5KHz
-  if (!(scanLineCounter & 1)) {
+  if (++lineRepeat == VGA_LINE_REPEAT) {   // counted from the first visible line, thus it doesn't depend on the frame parity
+    lineRepeat = 0;
     linePixel++;
+#if VGA_LINE_BUFFER
+    shownBuffer ^= 1;
+#endif
   }
   if (TIM4_REG->CNT == 515) {
     videoOn = 0;
     frameNumber++;
+#if VGA_MEASURE_ISR
+    isrFrameCycles = isrCycles;
+    isrCycles = 0;
+#endif
   }
   if (TIM4_REG->CNT == 35) {
     videoOn = 1;
     linePixel = 0;
+    lineRepeat = 0;
+#if VGA_LINE_BUFFER
+    shownBuffer = 0;
+    buildLine(lineBuffer[0], 0);
+#if VGA_FINE_SCROLL
+    alignLine(lineBuffer[0]);
+    buildLine(lineBuffer[1], 1);      // it is aligned after the first scanline, as any other line
+#endif
+#endif
+  }
+#if VGA_FINE_SCROLL
+  // a scrolled line takes about twice the time of a plain one, thus it is split: expanded right after the last scanline
+  // of the previous pixel line was sent, when its buffer is free, and aligned after the first scanline of the current one
+  else if (videoOn && lineRepeat == 0 && linePixel < VRAM_HEIGHT * TILE_H - 1) {
+    buildLine(lineBuffer[shownBuffer ^ 1], linePixel + 1);
+  }
+  else if (videoOn && lineRepeat == 1) {
+    alignLine(lineBuffer[shownBuffer ^ 1]);
+  }
+#elif VGA_LINE_BUFFER
+  // the next pixel line is built right after the first scanline of the current one was sent
+  else if (videoOn && lineRepeat == 1 && linePixel < VRAM_HEIGHT * TILE_H - 1) {
+    buildLine(lineBuffer[shownBuffer ^ 1], linePixel + 1);
+  }
+#endif
+
+  // it runs after the scanline was sent, thus it never delays pixels
+  if (inputIDR0 && !--inputCountdown) {
+    inputCountdown = inputLines;
+    uint32_t state = (*inputIDR0 & inputMask0) | (inputIDR1 ? (*inputIDR1 & inputMask1) << 16 : 0);
+    if (state != inputLastState) {
+      uint8_t next = (inputHead + 1) & (INPUT_EVENT_QUEUE_SIZE - 1);
+      if (next != inputTail) {      // when the queue is full, the change is lost
+        inputQueue[inputHead].scanLine = scanLineCounter;
+        inputQueue[inputHead].state = state;
+        asm volatile ("" ::: "memory");   // event is stored before it is published
+        inputHead = next;
+        inputLastState = state;
+      }
+    }
   }
+
+#if VGA_MEASURE_ISR
+  uint32_t cycles = DWT_CYCCNT_REG - isrStartCycle;
+  isrCycles += cycles;
+  if (cycles > isrMaxCycles) isrMaxCycles = cycles;
+#endif
 }
 
 
@@ -227,16 +525,18 @@ void video_init(uint8_t flashFont) {
   TIM1_REG->CNT = 0;
   TIM1_REG->ARR = 2287;
   TIM1_REG->CCR2 = 275;
-  TIM1_REG->CCR1 = flashFont ? 10 : 135;
+  TIM1_REG->CCR1 = VIDEO_CCR1(flashFont);
   TIM1_REG->CCMR1 = 0x7800;
   
   TIM4_REG->CR1 = 0x80;
-  TIM4_REG->CCER = 0x1;
+  TIM4_REG->CCER = 0x1001;     // CC1 is VSync, CC4 is VBLANK trigger (PB9 is not driven unless set as alternate function)
   TIM4_REG->PSC = 0;
   TIM4_REG->ARR = 524;
   TIM4_REG->CNT = 0;
   TIM4_REG->CCR1 = 1;
   TIM4_REG->CCMR1 = 0x0078;
+  TIM4_REG->CCR4 = VBLANK_TRIGGER_LINE;
+  TIM4_REG->CCMR2 = 0x7000;    // PWM mode 2 - OC4REF rises once per frame at VBLANK_TRIGGER_LINE
   TIM4_REG->SMCR = 0x07;
 
 #ifdef ARDUINO_ARCH_STM32F1  // Roger's BluePill Core https://github.com/rogerclarkmelbourne/Arduino_STM32
@@ -247,13 +547,47 @@ void video_init(uint8_t flashFont) {
   NVIC_EnableIRQ(TIM1_CC_IRQn);
   TIM1_REG->BDTR = 0x8000;
   TIM1_REG->DIER = 2;
-  TIM1_REG->CCR1 = flashFont ? 40 : 165;
+#endif
+
+  // VGA interrupt preempts any other interrupt
+  NVIC_PRIORITY_REG(TIM1_CC_IRQ_NUMBER) = 0;
+
+  // enables DWT cycle counter for frame time accounting in BlueVGA::waitVSync()
+  DEMCR_REG |= 0x01000000;     // TRCENA
+  DWT_CTRL_REG |= 0x1;         // CYCCNTENA
+
+#if VGA_TILE_2BPP
+  // default palettes - from background (0) to brightest color (3)
+  const uint8_t defaultPalette[4] = {RGB_BLACK, RGB_BLUE, RGB_CYAN, RGB_WHITE};
+  for (uint8_t p = 0; p < VGA_PALETTES; p++) video_set_palette(p, defaultPalette);
 #endif
 
   TIM4_REG->CR1 |= 0x1;
   TIM1_REG->CR1 |= 0x1;
 }
 
+void input_capture_init(volatile uint32_t *idr0, uint16_t mask0, volatile uint32_t *idr1, uint16_t mask1, uint16_t everyLines) {
+  inputIDR0 = 0;    // stops sampling while it is reconfigured
+  asm volatile ("" ::: "memory");     // nothing below is stored before sampling stops
+  inputMask0 = mask0;
+  inputMask1 = mask1;
+  inputIDR1 = idr1;
+  inputLines = everyLines ? everyLines : 1;
+  inputCountdown = inputLines;
+  inputLastState = (idr0 ? *idr0 & mask0 : 0) | (idr1 ? (*idr1 & mask1) << 16 : 0);
+  inputTail = inputHead;
+  asm volatile ("" ::: "memory");     // everything above is stored before sampling restarts
+  inputIDR0 = idr0;
+}
+
+uint8_t input_capture_read(inputEvent *event) {
+  if (inputTail == inputHead) return 0;
+  *event = inputQueue[inputTail];
+  asm volatile ("" ::: "memory");     // event is copied before its slot is released
+  inputTail = (inputTail + 1) & (INPUT_EVENT_QUEUE_SIZE - 1);
+  return 1;
+}
+
 // stops timers and VGA sinal
 void video_end() {
   TIM1_REG->CR1 &= ~0x1;
@@ -31,17 +31,73 @@
 
 #include "vgaProperties.h"
 
+// Cortex-M3 DWT cycle counter - it is used to measure how many CPU cycles the sketch takes in each frame
+#define DWT_CYCCNT_REG        (*(volatile uint32_t *)0xE0001004)
+// each frame takes 525 scanlines of 2288 cycles @ 72MHz (TIM1 ARR + 1)
+#define CYCLES_PER_FRAME      (2288UL * 525)
+// TIM4 counts scanlines (0 to 524) and its CC4 event happens once per frame at this line, within VBLANK
+// it can be used as hardware trigger for peripherals such as ADC1 (EXTSEL = TIM4_CC4) without disturbing video timing
+#define VBLANK_TRIGGER_LINE   517
+// Cortex-M3 NVIC priority register of each interrupt - STM32F103 uses the 4 high bits, 0 is the highest priority
+// VGA interrupt (TIM1 CC) has priority 0, thus any other interrupt must have a lower priority not to delay scanlines
+#define NVIC_PRIORITY_REG(irq)  (*((volatile uint8_t *)0xE000E400 + (irq)))
+#define TIM1_CC_IRQ_NUMBER      27
+// TIM1 CCR1 - cycle of each scanline when the VGA interrupt starts
+// scanLine() fetches the tiles of the line before sending pixels and flash is slower than RAM, thus flash tiles start earlier
+// the line buffer renderer only reads RAM while sending pixels - it starts where its image is centered as the one of scanLine()
+#ifdef ARDUINO_ARCH_STM32
+#define VIDEO_START_FLASH       40
+#define VIDEO_START_RAM         165
+#else
+#define VIDEO_START_FLASH       10
+#define VIDEO_START_RAM         135
+#endif
+#define VIDEO_START_LINE_BUFFER (VIDEO_START_RAM + 140 + (28 * 8 * 6) / 2 - (VRAM_WIDTH * 8 * VGA_PIXEL_CYCLES) / 2)
+#define VIDEO_CCR1(flashFont)   (VGA_LINE_BUFFER ? VIDEO_START_LINE_BUFFER : (flashFont) ? VIDEO_START_FLASH : VIDEO_START_RAM)
+
+// input change captured by the scanline interrupt
+#define INPUT_EVENT_QUEUE_SIZE  16    // must be a power of 2
+typedef struct {
+  uint32_t scanLine;      // scanLineCounter when the change was sampled - each scanline takes 31.7775 microseconds
+  uint32_t state;         // masked IDR of first port in the low 16 bits and of the second port in the high 16 bits
+} inputEvent;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 void video_init(uint8_t flashFont);
 void video_end(void);
+#if VGA_TILE_2BPP
+// sets the 4 RGB0 colors of a palette
+void video_set_palette(uint8_t palette, const uint8_t *colors);
+#endif
+#if VGA_FRAME_WINDOW
+// shows tilesW * 8 x tilesH * 8 pixels of buffer (tilesW bytes per line) from tile tileX, tileY - buffer NULL hides it
+void video_set_window(const uint8_t *buffer, uint8_t tileX, uint8_t tileY, uint8_t tilesW, uint8_t tilesH);
+#endif
+#if VGA_FINE_SCROLL
+// shows TRAM/CRAM from pixel column pixelX on, wrapping around the rows - only rows firstRow to firstRow + rows - 1 scroll
+void video_set_scroll(uint16_t pixelX);
+void video_set_scroll_rows(uint8_t firstRow, uint8_t rows);
+#endif
+// samples up to 2 GPIO ports every <everyLines> scanlines inside the VGA interrupt and queues any change (everyLines = 525 is once per frame)
+// calling it with idr0 as NULL stops capturing
+void input_capture_init(volatile uint32_t *idr0, uint16_t mask0, volatile uint32_t *idr1, uint16_t mask1, uint16_t everyLines);
+// pops the oldest captured change, returns 0 when the queue is empty
+uint8_t input_capture_read(inputEvent *event);
 // using VRAM_HEIGHT + 1 to make possible a simple way for scrolling text and graphics
 extern uint8_t TRAM [VRAM_HEIGHT][VRAM_WIDTH];  // VRAM with Characters or Tiles of 8 x 8 pixels
-extern uint8_t CRAM [VRAM_HEIGHT][VRAM_WIDTH];  // Color VRAM - color = 3bits + 3bits (Foreground + Background) - 8 colors on PC15-PC13 port (RGB)
+extern uint8_t CRAM [VRAM_HEIGHT][CRAM_WIDTH];  // Color VRAM - color = 3bits + 3bits (Foreground + Background) - 8 colors on PC15-PC13 port (RGB)
 extern uint8_t *TBitmap;
+#if VGA_MIXED_TILES
+extern uint8_t *TBitmapRam;
+#endif
 extern volatile uint32_t frameNumber;
 extern volatile uint32_t scanLineCounter;
+#if VGA_MEASURE_ISR
+extern volatile uint32_t isrMaxCycles;        // longest VGA interrupt since last reset
+extern volatile uint32_t isrFrameCycles;      // cycles taken by the VGA interrupt during the last whole frame
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -30,8 +30,188 @@
 #ifndef VGA_SIZE_H
 #define VGA_SIZE_H
 
+/*
+   Resolution profiles - the screen size is fixed at compile time.
+   In STM32 Core, add a line such as -DVGA_PROFILE=VGA_PROFILE_28x15 to build_opt.h of the sketch.
+   In Roger's Core, change the default VGA_PROFILE below.
+   Lower resolution profiles use smaller TRAM/CRAM. VGA_PROFILE_16x30 also takes less ISR time per scanline.
+*/
+#define VGA_PROFILE_28x30     0            // 224x240 pixels - each pixel line is sent twice (default)
+#define VGA_PROFILE_28x15     1            // 224x120 pixels - each pixel line is sent 4 times
+#define VGA_PROFILE_16x30     2            // 128x240 pixels - pixels are twice as wide
+#define VGA_PROFILE_32x30     3            // 256x240 pixels - narrower pixels, always uses the line buffer renderer
+
+#ifndef VGA_PROFILE
+#define VGA_PROFILE           VGA_PROFILE_28x30
+#endif
+
+/*
+   Line buffer renderer - instead of scanLine() fetching tiles and colors while it sends pixels, each pixel line is
+   expanded into RAM, already in port format, while the previous one is displayed. Sending it takes only ldr + strb.
+   It costs 8 bytes of RAM per column (double buffered) and the expansion takes about 16 cycles per tile every
+   VGA_LINE_REPEAT scanlines, out of the timing critical part of the interrupt.
+*/
+#ifndef VGA_LINE_BUFFER
+#define VGA_LINE_BUFFER       0
+#endif
+
+/*
+   Row colors - a single FG/BG color for each row of tiles instead of one per tile.
+   CRAM shrinks to 4 bytes per row and setting the color of any tile paints its whole row, which fits text consoles
+   that use one color per line. scanLine() loads the row color once per scanline instead of once every 4 tiles and
+   the line buffer renderer expands rows faster, what makes VGA_PROFILE_32x30 cheaper.
+*/
+#ifndef VGA_ROW_COLORS
+#define VGA_ROW_COLORS        0
+#endif
+
+/*
+   2bpp tiles - each pixel selects one of 4 colors of a palette and the color byte of each tile (CRAM) is its palette number.
+   Tiles take 16 bytes: 2 bytes per pixel line, 4 pixels per byte with the leftmost pixel in bits 7-6.
+   Thus ramFont holds 128 tiles. It always uses the line buffer renderer, which expands a pair of pixels per table lookup.
+   EXPERIMENTAL - its ISR cost is not measured on hardware yet, thus it is not known to keep the VGA timing. Counting the instructions of the loops gives an estimate of 22 cycles per tile for 2bpp
+   against 16 for 1bpp, around 170 more cycles every 2 scanlines on 28 columns, but flash wait states and the bus may change it.
+   Before relying on 2bpp, build both settings with VGA_MEASURE_ISR and compare BlueVGA::getISRMaxCycles(), which must stay
+   below a scanline (2288 cycles), and getISRFrameCycles().
+*/
+#ifndef VGA_TILE_2BPP
+#define VGA_TILE_2BPP         0
+#endif
+#if VGA_TILE_2BPP
+#define TILE_BYTES            16
+#define VGA_PALETTES          16           // palettes of 4 colors, selected by the low nibble of CRAM
+#undef  VGA_LINE_BUFFER
+#define VGA_LINE_BUFFER       1
+#else
+#define TILE_BYTES            8
+#endif
+#define RAM_FONT_TILES        (2048 / TILE_BYTES)
+
+/*
+   Frame window - a rectangle of the screen, aligned to tiles, shows a linear 1bpp frame buffer instead of tiles.
+   Its pixels are plotted in O(1) with BlueBitmap::drawFramePixel() with no RAM tile allocation, and its colors are still
+   the CRAM colors of the tiles under it. It needs the line buffer renderer and 1bpp tiles.
+*/
+#ifndef VGA_FRAME_WINDOW
+#define VGA_FRAME_WINDOW      0
+#endif
+#if VGA_FRAME_WINDOW
+#if VGA_TILE_2BPP
+#error "VGA_FRAME_WINDOW works with 1bpp tiles only"
+#endif
+#undef  VGA_LINE_BUFFER
+#define VGA_LINE_BUFFER       1
+#endif
+
+/*
+   Mixed tile banks - tiles 0..127 come from the font set by BlueVGA() or setFontBitmap(), usually a Flash font, and
+   tiles 128..255 from BlueBitmap::ramFont, or another RAM bank set by BlueVGA::setRamTileBank(). Bit 7 of the tile
+   number of each cell selects its bank, thus text and pixel drawing share the screen with no font copy to RAM.
+   The line buffer renderer reads both banks before the scanline is sent, so Flash wait states never delay pixels.
+   BlueBitmap draws pixels on RAM tiles from RAM_BANK_FIRST_TILE on. It works with 1bpp tiles only.
+*/
+#ifndef VGA_MIXED_TILES
+#define VGA_MIXED_TILES       0
+#endif
+#if VGA_MIXED_TILES
+#if VGA_TILE_2BPP
+#error "VGA_MIXED_TILES works with 1bpp tiles only"
+#endif
+#undef  VGA_LINE_BUFFER
+#define VGA_LINE_BUFFER       1
+#define RAM_BANK_FIRST_TILE   128
+#endif
+
+/*
+   Horizontal scroll - the screen shows TRAM/CRAM from any pixel column set by BlueVGA::setScrollX(), wrapping around the
+   rows, thus a side scroller only writes the new column of tiles that enters the screen every 8 pixels.
+   BlueVGA::setScrollRows() keeps rows out of the scroll, e.g. a score line. The line buffer renderer expands one more tile
+   right after the previous pixel line was sent and shifts it to the pixel offset after the first scanline of the line,
+   thus each part takes about the time of a plain expansion. It needs 1bpp tiles and no frame window.
+*/
+#ifndef VGA_FINE_SCROLL
+#define VGA_FINE_SCROLL       0
+#endif
+#if VGA_FINE_SCROLL
+#if VGA_TILE_2BPP || VGA_FRAME_WINDOW
+#error "VGA_FINE_SCROLL works with 1bpp tiles and no VGA_FRAME_WINDOW"
+#endif
+#undef  VGA_LINE_BUFFER
+#define VGA_LINE_BUFFER       1
+#endif
+
+#ifndef VGA_MEASURE_ISR
+#define VGA_MEASURE_ISR       0
+#endif
+
+/*
+   Number of recent waitVSync() periods kept by BlueVGA for getFrameHistory(). It sizes a BlueVGA member, thus as any
+   option here it must be the same for the library and the sketch: set it in build_opt.h, never with a #define in a sketch file.
+*/
+#ifndef FRAME_HISTORY_SIZE
+#define FRAME_HISTORY_SIZE    16
+#endif
+#if FRAME_HISTORY_SIZE < 1 || FRAME_HISTORY_SIZE > 255
+#error "FRAME_HISTORY_SIZE must be from 1 to 255"
+#endif
+
+/*
+   Built-in Flash fonts of bluefonts.h - a single copy is shared by all sketch files, 4 bytes aligned for 32 bits reads.
+   Set any of them to 0 to keep it out of the library, even when the linker does not discard unused data.
+*/
+#ifndef VGA_FONT_ASCII
+#define VGA_FONT_ASCII        1
+#endif
+#ifndef VGA_FONT_CGA
+#define VGA_FONT_CGA          1
+#endif
+#ifndef VGA_FONT_CGA_LIGHT
+#define VGA_FONT_CGA_LIGHT    1
+#endif
+
+#if VGA_PROFILE == VGA_PROFILE_28x15
+#define VRAM_WIDTH            28
+#define VRAM_HEIGHT           15
+#define VGA_LINE_REPEAT       4            // number of scanlines that display the same pixel line
+#define VGA_PIXEL_CYCLES      6            // CPU cycles per pixel
+#elif VGA_PROFILE == VGA_PROFILE_16x30
+#define VRAM_WIDTH            16
+#define VRAM_HEIGHT           30
+#define VGA_LINE_REPEAT       2
+#define VGA_PIXEL_CYCLES      11           // about the same screen width as 28 columns
+#elif VGA_PROFILE == VGA_PROFILE_32x30
+#define VRAM_WIDTH            32
+#define VRAM_HEIGHT           30
+#define VGA_LINE_REPEAT       2
+#define VGA_PIXEL_CYCLES      5            // 256 x 5 cycles is a bit narrower than 224 x 6
+#undef  VGA_LINE_BUFFER
+#define VGA_LINE_BUFFER       1            // scanLine() needs 6 cycles per pixel, only the line buffer renderer can send 5
+#else
 #define VRAM_WIDTH            28           // Screen is composed by 28x30 characters or tiles of 8x8 pixels each
 #define VRAM_HEIGHT           30           // Thus it is designed to displaying those tiles in any place in the screen of 28x30 
+#define VGA_LINE_REPEAT       2
+#define VGA_PIXEL_CYCLES      6
+#endif
+
+// scanLine() takes 6 cycles per pixel and adds nops for slower pixel clocks, the line buffer renderer needs at least 4
+#define VGA_PIXEL_PAD         (VGA_PIXEL_CYCLES - 6)
+#if VGA_PIXEL_CYCLES < (VGA_LINE_BUFFER ? 4 : 6)
+#error "VGA_PIXEL_CYCLES is too short for the selected renderer"
+#endif
+
+// scanLine() sends 4 tiles for each 32 bits read and rows are copied 32 bits at once
+#if VRAM_WIDTH & 3
+#error "VRAM_WIDTH must be a multiple of 4"
+#endif
+#if VGA_ROW_COLORS
+#define CRAM_WIDTH            4            // only byte 0 holds the row color, the row is padded to one 32 bits word
+#define CRAM_CELL(y, x)       CRAM[y][0]
+#else
+#define CRAM_WIDTH            VRAM_WIDTH
+#define CRAM_CELL(y, x)       CRAM[y][x]
+#endif
+#define CRAM_ROW_WORDS        (CRAM_WIDTH / 4)
+#define VRAM_ROW_WORDS        (VRAM_WIDTH / 4)
 #define TILE_W                8            // Tile Width
 #define TILE_H                8            // Tile Height
 
@@ -0,0 +1,294 @@
+#
+#   BlueVGA library - host side helpers shared by the command line tools in this folder
+#
+#   - PNG reader (no external modules needed, only Python 3 standard library)
+#   - RGB to BlueVGA RGB0 color conversion
+#   - run-length encoder with the same format used by BlueVGA::saveScreen() and BlueVGA::drawLayout()
+#   - BDF font reader
+#   - 8x8 tile slicing and deduplication
+#   - C header array reader and writer
+#
+#   Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+#   Copyright 2017-2021 Rodrigo Patricio Garcia Corbera.
+#   All rights reserved.
+#
+#   This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+
+import re
+import struct
+import zlib
+
+# same values as rgbColors in vgaProperties.h
+RGB_COLORS = {
+    'BLACK': 0x0, 'BLUE': 0x2, 'GREEN': 0x4, 'CYAN': 0x6,
+    'RED': 0x8, 'MAGENTA': 0xA, 'YELLOW': 0xC, 'WHITE': 0xE,
+}
+
+TILE_W = 8
+TILE_H = 8
+
+
+class ToolError(Exception):
+    pass
+
+
+def color_by_name(name):
+    name = name.upper()
+    if name.startswith('RGB_'):
+        name = name[4:]
+    if name not in RGB_COLORS:
+        raise ToolError("unknown color '%s' - use one of %s" % (name, ', '.join(RGB_COLORS)))
+    return RGB_COLORS[name]
+
+
+def rgb_to_color(r, g, b):
+    """ Nearest of the 8 BlueVGA colors - each channel is either on or off """
+    return (0x8 if r >= 128 else 0) | (0x4 if g >= 128 else 0) | (0x2 if b >= 128 else 0)
+
+
+def color_code(fg, bg):
+    """ CRAM byte: background in the high nibble, foreground in the low one """
+    return ((bg & 0x0F) << 4) | (fg & 0x0F)
+
+
+def read_png(path):
+    """ Returns (width, height, rows) where rows is a list of lists of (r, g, b) tuples.
+        Supports non-interlaced grayscale, RGB, palette, gray + alpha and RGBA images. """
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ToolError('%s is not a PNG file' % path)
+    pos = 8
+    idat = b''
+    palette = []
+    width = height = depth = ctype = interlace = None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+    if width is None:
+        raise ToolError('%s has no PNG header' % path)
+    if interlace:
+        raise ToolError('%s: interlaced PNG is not supported' % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if channels is None:
+        raise ToolError('%s: unknown PNG color type %d' % (path, ctype))
+    if depth != 8 and ctype not in (0, 3):
+        raise ToolError('%s: only 8 bits per channel is supported for this color type' % path)
+    if depth > 8:
+        raise ToolError('%s: 16 bits grayscale PNG is not supported' % path)
+
+    raw = zlib.decompress(idat)
+    bits_pp = channels * depth
+    stride = (width * bits_pp + 7) // 8
+    bpp = max(1, bits_pp // 8)
+    rows = []
+    prev = bytearray(stride)
+    p = 0
+    for _ in range(height):
+        ftype = raw[p]
+        line = bytearray(raw[p + 1:p + 1 + stride])
+        p += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+
+        pixels = []
+        if depth < 8:
+            mask = (1 << depth) - 1
+            for x in range(width):
+                bit = x * depth
+                v = (line[bit // 8] >> (8 - depth - bit % 8)) & mask
+                if ctype == 3:
+                    pixels.append(palette[v])
+                else:
+                    v = v * 255 // mask
+                    pixels.append((v, v, v))
+        else:
+            for x in range(width):
+                px = line[x * channels:(x + 1) * channels]
+                if ctype == 0 or ctype == 4:
+                    pixels.append((px[0], px[0], px[0]))
+                elif ctype == 3:
+                    pixels.append(palette[px[0]])
+                else:
+                    pixels.append(tuple(px[:3]))
+        rows.append(pixels)
+    return width, height, rows
+
+
+def image_to_colors(rows):
+    """ Converts (r, g, b) rows into rows of RGB0 colors """
+    return [[rgb_to_color(*px) for px in row] for row in rows]
+
+
+def read_bdf(path):
+    """ Returns {encoding: 8 bytes tile} for the glyphs of a BDF font, aligned to the font baseline.
+        Glyphs are placed as the BDF bounding boxes say and anything outside the 8x8 cell is clipped. """
+    glyphs = {}
+    ascent = None
+    font_box = None
+    with open(path, 'r', encoding='latin-1') as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'FONTBOUNDINGBOX':
+            font_box = [int(v) for v in words[1:5]]
+        elif words[0] == 'FONT_ASCENT':
+            ascent = int(words[1])
+        elif words[0] == 'STARTCHAR':
+            code, box, bitmap = -1, font_box, []
+            for line in lines:
+                words = line.split()
+                if not words:
+                    continue
+                if words[0] == 'ENCODING':
+                    code = int(words[1])
+                elif words[0] == 'BBX':
+                    box = [int(v) for v in words[1:5]]
+                elif words[0] == 'BITMAP':
+                    for line in lines:
+                        if line.strip() == 'ENDCHAR':
+                            break
+                        bitmap.append(line.strip())
+                    break
+            if code < 0 or box is None:
+                continue
+            if ascent is None:
+                ascent = (font_box[1] + font_box[3]) if font_box else TILE_H
+            w, h, xoff, yoff = box
+            # cell row of the top of the glyph: baseline is at row 'ascent', glyph top is yoff + h above it
+            top = ascent - (yoff + h)
+            left = xoff - (font_box[2] if font_box else 0)
+            tile = bytearray(TILE_H)
+            for r, hexrow in enumerate(bitmap[:h]):
+                y = top + r
+                if not hexrow or not 0 <= y < TILE_H:
+                    continue
+                bits, nbits = int(hexrow, 16), 4 * len(hexrow)
+                for c in range(min(w, nbits)):
+                    x = left + c
+                    if 0 <= x < TILE_W and bits >> (nbits - 1 - c) & 1:
+                        tile[y] |= 0x80 >> x
+            glyphs[code] = bytes(tile)
+    if not glyphs:
+        raise ToolError('%s has no BDF glyphs' % path)
+    return glyphs
+
+
+def image_tiles(colors, lit):
+    """ Splits rows of RGB0 colors into 8x8 tiles, left to right and top to bottom, MSB is the leftmost pixel.
+        lit(color) tells if a pixel is set. Returns (columns, rows, tiles). """
+    height = len(colors)
+    width = len(colors[0]) if height else 0
+    if width % TILE_W or height % TILE_H:
+        raise ToolError('image size %dx%d is not a multiple of 8' % (width, height))
+    tiles = []
+    for ty in range(0, height, TILE_H):
+        for tx in range(0, width, TILE_W):
+            tiles.append(bytes(sum(0x80 >> px for px in range(TILE_W) if lit(colors[ty + py][tx + px]))
+                               for py in range(TILE_H)))
+    return width // TILE_W, height // TILE_H, tiles
+
+
+class TileSet:
+    """ Unique tiles in order of appearance """
+
+    def __init__(self, dedup=True):
+        self.tiles = []
+        self.index = {}
+        self.dedup = dedup
+
+    def add(self, tile):
+        if self.dedup and tile in self.index:
+            return self.index[tile]
+        self.index.setdefault(tile, len(self.tiles))
+        self.tiles.append(tile)
+        return len(self.tiles) - 1
+
+    def find(self, tile):
+        return self.index.get(tile)
+
+    def __len__(self):
+        return len(self.tiles)
+
+    def data(self):
+        return b''.join(self.tiles)
+
+
+def rle_encode(data):
+    """ Runs of 3 to 128 equal bytes are (0x80 | n - 1) + byte, other bytes go in literal blocks of (n - 1) + n bytes """
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            out += bytes((0x80 | (run - 1), data[i]))
+            i += run
+        else:
+            lit = 0
+            while i + lit < n and lit < 128 and not (
+                    i + lit + 2 < n and data[i + lit] == data[i + lit + 1] == data[i + lit + 2]):
+                lit += 1
+            out.append(lit - 1)
+            out += bytes(data[i:i + lit])
+            i += lit
+    return bytes(out)
+
+
+def read_c_array(path, name=None):
+    """ Returns the bytes of a 'const uint8_t name[...] = { ... };' array of a C header, the first one if name is None """
+    with open(path, 'r', encoding='utf-8', errors='replace') as f:
+        text = f.read()
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    for m in re.finditer(r'uint8_t\s+(\w+)\s*(\[[^\]]*\])+\s*(__attribute__\s*\(\(.*?\)\))?\s*=\s*\{(.*?)\}\s*;', text, re.S):
+        if name is None or m.group(1) == name:
+            values = [v.strip() for v in m.group(4).replace('{', ',').replace('}', ',').split(',')]
+            return bytes(int(v, 0) & 0xFF for v in values if v)
+    raise ToolError('array %s not found in %s' % (name or 'uint8_t', path))
+
+
+def c_array(name, data, comment=None, per_line=16, section=None):
+    """ Formats data as a flash resident C array """
+    lines = []
+    if comment:
+        for c in comment.splitlines():
+            lines.append('// ' + c if c else '//')
+    attr = ' __attribute__((aligned(4)))' if section is None else ' __attribute__((aligned(4), section("%s")))' % section
+    lines.append('const uint8_t %s[%d]%s = {' % (name, len(data), attr))
+    for i in range(0, len(data), per_line):
+        lines.append('  ' + ', '.join('0x%02X' % b for b in data[i:i + per_line]) + ',')
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def c_header(guard, body, tool):
+    return ('// generated by tools/%s - do not edit\n\n#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n%s\n#endif\n'
+            % (tool, guard, guard, body))
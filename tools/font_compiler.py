@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+#   BlueVGA library - font and image tile set compiler
+#
+#   Converts PNG images and BDF fonts into BlueVGA tile arrays: 8 bytes per tile, one byte per pixel row from top to
+#   bottom, most significant bit is the leftmost pixel. The same layout used by the Flash fonts and by BlueBitmap::ramFont.
+#
+#   Identical tiles are stored once and an index map tells which tile is used in each place:
+#   - PNG input: one map entry per 8x8 cell of the image, left to right and top to bottom
+#   - BDF input: one map entry per character code, from --first to --last
+#
+#   A font used by print() must have each glyph at its character code, for that use --no-dedup: tile n of the array is
+#   then the glyph of code first + n. With --first 0 the array is indexed by character code, the same as the fonts of
+#   bluefonts.h, and can be given to BlueVGA() or setFontBitmap(). An array from --first 32 leaves the control codes out
+#   and goes to RAM tiles at their codes with BlueBitmap::loadFontToRam(myFont, 0, MYFONT_TILES, 32).
+#
+#   Usage:
+#     font_compiler.py font.bdf -n myFont --first 0 --last 127 --no-dedup -o myfont.h
+#     font_compiler.py sprites.png -n sprites --base 1 -o sprites.h
+#
+#   Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+#   Copyright 2017-2021 Rodrigo Patricio Garcia Corbera.
+#   All rights reserved.
+#
+#   This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+
+import argparse
+import os
+import sys
+
+from bluevga_tools import (ToolError, TileSet, TILE_H, color_by_name, read_png, image_to_colors, image_tiles,
+                           read_bdf, c_array, c_header)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Compiles PNG images and BDF fonts into BlueVGA 8x8 tile arrays')
+    ap.add_argument('inputs', nargs='+', help='PNG images and/or BDF fonts, tiles are added in the given order')
+    ap.add_argument('-n', '--name', help='C array name (default: first input file name)')
+    ap.add_argument('-o', '--output', help='output header (default: stdout)')
+    ap.add_argument('--first', type=lambda s: int(s, 0), default=0, help='first BDF character code (default 0)')
+    ap.add_argument('--last', type=lambda s: int(s, 0), default=255, help='last BDF character code (default 255)')
+    ap.add_argument('--background', default='BLACK',
+                    help='PNG pixels of this color are off, any other color is on (default BLACK)')
+    ap.add_argument('--base', type=lambda s: int(s, 0), default=0,
+                    help='tile number of the first tile in the map, e.g. the RAM tile where the set is copied (default 0)')
+    ap.add_argument('--no-dedup', dest='dedup', action='store_false', help='keep every tile, even repeated ones')
+    ap.add_argument('--no-map', dest='map', action='store_false', help='do not emit the index map')
+    args = ap.parse_args()
+
+    tileset = TileSet(args.dedup)
+    maps = []
+    try:
+        off = color_by_name(args.background)
+        for path in args.inputs:
+            if path.lower().endswith('.bdf'):
+                glyphs = read_bdf(path)
+                blank = bytes(TILE_H)
+                codes = range(args.first, args.last + 1)
+                maps.append((path, len(codes), [tileset.add(glyphs.get(c, blank)) for c in codes]))
+            else:
+                width, height, rows = read_png(path)
+                cols, _, tiles = image_tiles(image_to_colors(rows), lambda c: c != off)
+                maps.append((path, cols, [tileset.add(t) for t in tiles]))
+        if args.base + len(tileset) > 256:
+            raise ToolError('%d tiles starting at tile %d do not fit in the 256 tiles of BlueVGA' % (len(tileset), args.base))
+    except (ToolError, OSError, ValueError) as e:
+        sys.exit('font_compiler: %s' % e)
+
+    name = args.name or os.path.splitext(os.path.basename(args.inputs[0]))[0]
+    used = sum(len(m) for _, _, m in maps)
+    report = '%d unique tiles of %d (%d bytes, %d bytes saved)' % (len(tileset), used, len(tileset) * TILE_H,
+                                                                  (used - len(tileset)) * TILE_H)
+    body = '#define %s_TILES %d\n\n' % (name.upper(), len(tileset))
+    body += c_array(name, tileset.data(), '%s - %s' % (', '.join(os.path.basename(p) for p in args.inputs), report))
+    if args.map:
+        for i, (path, cols, m) in enumerate(maps):
+            suffix = '_map' if len(maps) == 1 else '_map%d' % i
+            what = 'per character code from %d' % args.first if path.lower().endswith('.bdf') else \
+                '%d columns x %d rows of 8x8 cells' % (cols, len(m) // cols)
+            body += '\n' + c_array(name + suffix, bytes(args.base + t for t in m),
+                                   'tile of %s - %s' % (os.path.basename(path), what), per_line=max(cols, 1) if cols <= 32 else 16)
+    text = c_header(name.upper() + '_H', body, os.path.basename(sys.argv[0]))
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write('%s: %s\n' % (name, report))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+#
+#   BlueVGA library - full screen image importer
+#
+#   Converts a picture (224x240 pixels fills the 28x30 screen) into the smallest tile set that draws it, plus the
+#   TRAM and CRAM contents that place those tiles on the screen.
+#
+#   - each 8x8 cell is reduced to the two BlueVGA colors (rgbColors) that best represent it
+#   - a cell that is the inverse of an existing tile reuses it with foreground and background swapped
+#   - identical cells share the same tile, so plain areas cost a single tile
+#
+#   The tiles are 1bpp, 8 bytes each, thus the output is only for builds with VGA_TILE_2BPP = 0 (the default), where
+#   TILE_BYTES is 8. The tile set goes to BlueBitmap::ramFont starting at --base, leaving the other RAM tiles free for drawing:
+#
+#     BlueBitmap::loadFontToRam(img, 0, IMG_TILES, IMG_BASE);
+#     memcpy(TRAM, img_tram, sizeof(img_tram));   // when the image has the size of the screen
+#     memcpy(CRAM, img_cram, sizeof(img_cram));
+#
+#   or, with --layout, vga.drawLayout(img_layout) places the image at --at on any screen size.
+#
+#   Usage:
+#     image_importer.py picture.png -n img --base 128 --layout -o img.h
+#
+#   Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+#   Copyright 2017-2021 Rodrigo Patricio Garcia Corbera.
+#   All rights reserved.
+#
+#   This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+
+import argparse
+import os
+import sys
+
+from bluevga_tools import (ToolError, TileSet, TILE_W, TILE_H, color_code, read_png, image_to_colors, rle_encode,
+                           c_array, c_header)
+
+
+def distance(a, b):
+    """ number of different RGB channels of two RGB0 colors """
+    return bin((a ^ b) & 0x0E).count('1')
+
+
+def two_colors(count):
+    """ Returns (fg, bg, error) with the pair of colors that represents the cell pixels with the smallest error """
+    used = sorted(count, key=lambda c: (-count[c], c))
+    if len(used) <= 2:
+        return used[-1], used[0], 0
+    best = None
+    for i, a in enumerate(used):
+        for b in used[i + 1:]:
+            err = sum(n * min(distance(c, a), distance(c, b)) for c, n in count.items())
+            if best is None or err < best[2]:
+                best = (b, a, err)     # the most used of both colors is the background
+    return best
+
+
+def import_image(colors, tileset):
+    rows, cols = len(colors) // TILE_H, len(colors[0]) // TILE_W
+    tram, cram = bytearray(), bytearray()
+    stats = {'reduced': 0, 'inverted': 0}
+    for ty in range(rows):
+        for tx in range(cols):
+            cell = [colors[ty * TILE_H + py][tx * TILE_W:(tx + 1) * TILE_W] for py in range(TILE_H)]
+            count = {}
+            for line in cell:
+                for c in line:
+                    count[c] = count.get(c, 0) + 1
+            fg, bg, err = two_colors(count)
+            if err:
+                stats['reduced'] += 1
+            bitmap = bytes(sum(0x80 >> px for px in range(TILE_W)
+                               if fg != bg and (line[px] == fg or distance(line[px], fg) < distance(line[px], bg)))
+                           for line in cell)
+            inverted = bytes(b ^ 0xFF for b in bitmap)
+            tile = tileset.find(bitmap)
+            if tile is None and tileset.find(inverted) is not None:
+                tile = tileset.find(inverted)
+                fg, bg = bg, fg
+                stats['inverted'] += 1
+            elif tile is None:
+                # new tiles are stored with the top left pixel off, thus a plain cell and a full one are the same tile
+                if bitmap[0] & 0x80:
+                    bitmap, fg, bg = inverted, bg, fg
+                tile = tileset.add(bitmap)
+            if fg == bg:
+                fg = bg ^ 0x0E      # any visible foreground for plain cells, it is never drawn
+            tram.append(tile)
+            cram.append(color_code(fg, bg))
+    return cols, rows, tram, cram, stats
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Converts an image into a minimal BlueVGA tile set plus TRAM and CRAM arrays')
+    ap.add_argument('image', help='PNG image, width and height multiple of 8')
+    ap.add_argument('-n', '--name', help='C array name (default: image file name)')
+    ap.add_argument('-o', '--output', help='output header (default: stdout)')
+    ap.add_argument('--base', type=lambda s: int(s, 0), default=0, help='RAM tile number of the first tile (default 0)')
+    ap.add_argument('--layout', action='store_true', help='also emit a drawLayout() array')
+    ap.add_argument('--at', default='0,0', help='x,y screen tile of the image top left corner for --layout')
+    args = ap.parse_args()
+
+    tileset = TileSet()
+    try:
+        width, height, rows = read_png(args.image)
+        if width % TILE_W or height % TILE_H:
+            raise ToolError('%s: image size %dx%d is not a multiple of 8' % (args.image, width, height))
+        if width // TILE_W > 255 or height // TILE_H > 255:
+            raise ToolError('%s: image is too big' % args.image)
+        cols, nrows, tram, cram, stats = import_image(image_to_colors(rows), tileset)
+        if args.base + len(tileset) > 256:
+            raise ToolError('%d tiles starting at tile %d do not fit in the 256 RAM tiles' % (len(tileset), args.base))
+        at = [int(v, 0) for v in args.at.split(',')]
+    except (ToolError, OSError, ValueError) as e:
+        sys.exit('image_importer: %s' % e)
+
+    tram = bytes(args.base + t for t in tram)
+    name = args.name or os.path.splitext(os.path.basename(args.image))[0]
+    report = '%dx%d cells, %d unique tiles (%d inverted matches, %d cells reduced to 2 colors)' % (
+        cols, nrows, len(tileset), stats['inverted'], stats['reduced'])
+    body = '#define %s_BASE %d\n#define %s_TILES %d\n#define %s_COLUMNS %d\n#define %s_ROWS %d\n\n' % (
+        name.upper(), args.base, name.upper(), len(tileset), name.upper(), cols, name.upper(), nrows)
+    body += c_array(name, tileset.data(), '%s - %s\nRAM tiles %d to %d' % (
+        os.path.basename(args.image), report, args.base, args.base + len(tileset) - 1))
+    body += '\n' + c_array(name + '_tram', tram, 'tiles, row by row', per_line=min(cols, 32))
+    body += '\n' + c_array(name + '_cram', cram, 'colors, row by row', per_line=min(cols, 32))
+    if args.layout:
+        layout = bytes((cols, nrows, at[0], at[1])) + rle_encode(tram) + rle_encode(cram) + b'\x00'
+        body += '\n' + c_array(name + '_layout', layout, 'drawLayout() array at %d,%d' % tuple(at[:2]))
+    text = c_header(name.upper() + '_H', body, os.path.basename(sys.argv[0]))
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write('%s: %s\n' % (name, report))
+
+
+if __name__ == '__main__':
+    main()
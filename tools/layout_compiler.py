@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+#
+#   BlueVGA library - screen layout compiler
+#
+#   Converts a screen mockup into a flash resident layout array that is drawn with a single BlueVGA::drawLayout() call,
+#   instead of lots of setTile()/print() calls and RAM copies in setup().
+#
+#   The mockup can be:
+#
+#   - a text file with these sections (lines starting with # are comments):
+#
+#       [screen]            one line per tile row, one character per tile.
+#       |  SCORE<1>   HI-SCORE|  a line may be enclosed between | characters to keep its leading and trailing spaces
+#       [colors]            optional, one letter per tile, same positions as in [screen]
+#       |  YYYYYYYY   WWWWWWWW|
+#       [palette]           what each color letter means, ' ' and missing letters use the default colors
+#       Y = YELLOW on BLACK
+#       W = WHITE on BLUE
+#       [charmap]           optional, characters that are RAM tiles 1, 2, 3, ... (space is tile 0)
+#       HI-SCORE<>0123456789  without a charmap, each character is its ASCII code (Flash font)
+#
+#   - a PNG image (width and height multiple of 8) with at most 2 colors per 8x8 cell. Each cell is matched against
+#     the glyphs of a font C header (exact or inverted bitmap), giving its tile and its foreground/background colors.
+#
+#   Tiles that are blank and have the default colors are left out. Each band of consecutive non blank rows becomes one
+#   block clipped to its used columns, unless --rect or --full is used.
+#
+#   Usage:
+#     layout_compiler.py screen.txt -n titleScreen -o title_layout.h
+#     layout_compiler.py screen.png --font ../src/bluefonts.c:blueFontASCII -n titleScreen
+#
+#   Author Rodrigo Patricio Garcia Corbera (rocorbera@gmail.com)
+#   Copyright 2017-2021 Rodrigo Patricio Garcia Corbera.
+#   All rights reserved.
+#
+#   This code is licensed as Attribution-NonCommercial-ShareAlike 4.0 International (CC BY-NC-SA 4.0) - https://creativecommons.org/licenses/by-nc-sa/4.0/
+#
+
+import argparse
+import os
+import sys
+
+from bluevga_tools import (ToolError, TILE_W, TILE_H, color_by_name, color_code, read_png, image_to_colors,
+                           rle_encode, read_c_array, c_array, c_header)
+
+
+def parse_colors(text):
+    """ 'YELLOW on BLACK' or 'YELLOW' (black background) """
+    parts = text.split()
+    if len(parts) == 3 and parts[1].lower() == 'on':
+        return color_code(color_by_name(parts[0]), color_by_name(parts[2]))
+    if len(parts) == 1:
+        return color_code(color_by_name(parts[0]), 0)
+    raise ToolError("bad colors '%s' - use 'FG on BG'" % text)
+
+
+def read_text_mockup(path, default_color):
+    sections = {'screen': [], 'colors': [], 'palette': [], 'charmap': []}
+    current = None
+    with open(path, 'r', encoding='utf-8') as f:
+        for line in f.read().splitlines():
+            stripped = line.strip()
+            if stripped.startswith('[') and stripped.endswith(']') and stripped[1:-1].lower() in sections:
+                current = stripped[1:-1].lower()
+                continue
+            if current is None or (stripped.startswith('#') and current in ('palette', 'charmap')):
+                continue
+            if line.startswith('|'):
+                line = line[1:-1] if line.endswith('|') and len(line) > 1 else line[1:]
+            sections[current].append(line)
+
+    palette = {' ': default_color}
+    for entry in sections['palette']:
+        if not entry.strip():
+            continue
+        if '=' not in entry:
+            raise ToolError("bad palette entry '%s' - use 'Y = YELLOW on BLACK'" % entry)
+        letter, colors = entry.split('=', 1)
+        letter = letter.strip()
+        if len(letter) != 1:
+            raise ToolError("palette key '%s' must be a single character" % letter)
+        palette[letter] = parse_colors(colors.strip())
+
+    charmap = ''.join(sections['charmap'])
+    tiles, colors = [], []
+    for y, line in enumerate(sections['screen']):
+        crow = sections['colors'][y] if y < len(sections['colors']) else ''
+        trow, ccrow = [], []
+        for x, ch in enumerate(line):
+            if charmap:
+                if ch == ' ':
+                    tile = 0
+                elif ch in charmap:
+                    tile = charmap.index(ch) + 1
+                else:
+                    raise ToolError("character '%s' at %d,%d is not in [charmap]" % (ch, x, y))
+            else:
+                tile = ord(ch)
+                if tile > 255:
+                    raise ToolError("character '%s' at %d,%d is not a single byte tile" % (ch, x, y))
+            letter = crow[x] if x < len(crow) else ' '
+            if letter not in palette:
+                raise ToolError("color letter '%s' at %d,%d is not in [palette]" % (letter, x, y))
+            trow.append(tile)
+            ccrow.append(palette[letter])
+        tiles.append(trow)
+        colors.append(ccrow)
+    blank = 0 if charmap else ord(' ')
+    return tiles, colors, blank
+
+
+def read_png_mockup(path, font_path, font_first, default_color):
+    if ':' in font_path and not os.path.exists(font_path):
+        font_path, array = font_path.rsplit(':', 1)
+    else:
+        array = None
+    font = read_c_array(font_path, array)
+    glyphs = {}
+    for i in range(len(font) // TILE_H):
+        glyphs.setdefault(font[i * TILE_H:(i + 1) * TILE_H], font_first + i)
+
+    width, height, rows = read_png(path)
+    if width % TILE_W or height % TILE_H:
+        raise ToolError('%s: image size %dx%d is not a multiple of 8' % (path, width, height))
+    pixels = image_to_colors(rows)
+    blank = glyphs.get(bytes(TILE_H), 0)
+
+    tiles, colors = [], []
+    for ty in range(height // TILE_H):
+        trow, crow = [], []
+        for tx in range(width // TILE_W):
+            cell = [pixels[ty * TILE_H + py][tx * TILE_W:(tx + 1) * TILE_W] for py in range(TILE_H)]
+            count = {}
+            for line in cell:
+                for c in line:
+                    count[c] = count.get(c, 0) + 1
+            if len(count) > 2:
+                raise ToolError('tile %d,%d has %d colors, only 2 are possible' % (tx, ty, len(count)))
+            used = sorted(count, key=lambda c: -count[c])
+            bg = used[0]
+            if len(used) > 1:
+                fg = used[1]
+            else:
+                # a single color cell keeps the default foreground, so plain background areas are left out as blank
+                fg = default_color & 0x0F if bg == default_color >> 4 else bg
+            bitmap = bytes(sum(0x80 >> px for px in range(TILE_W) if line[px] == fg and fg != bg) for line in cell)
+            inverted = bytes(b ^ 0xFF for b in bitmap)
+            if bitmap in glyphs:
+                tile = glyphs[bitmap]
+            elif inverted in glyphs:
+                tile = glyphs[inverted]
+                fg, bg = bg, fg
+            else:
+                raise ToolError('tile %d,%d does not match any glyph of the font' % (tx, ty))
+            trow.append(tile)
+            crow.append(color_code(fg, bg))
+        tiles.append(trow)
+        colors.append(crow)
+    return tiles, colors, blank
+
+
+def make_blocks(tiles, colors, blank, default_color, origin, rect, full):
+    """ Returns a list of (x, y, w, h) rectangles in mockup coordinates """
+    height = len(tiles)
+    width = max([len(r) for r in tiles] + [0])
+    if full:
+        return [(0, 0, width, height)]
+    if rect:
+        return [tuple(x - o for x, o in zip(rect[:2], origin)) + tuple(rect[2:])]
+
+    def used(y, x):
+        return x < len(tiles[y]) and (tiles[y][x] != blank or colors[y][x] != default_color)
+
+    blocks = []
+    y = 0
+    while y < height:
+        if not any(used(y, x) for x in range(width)):
+            y += 1
+            continue
+        top = y
+        while y < height and any(used(y, x) for x in range(width)):
+            y += 1
+        columns = [x for x in range(width) if any(used(r, x) for r in range(top, y))]
+        blocks.append((columns[0], top, columns[-1] - columns[0] + 1, y - top))
+    return blocks
+
+
+def build_layout(tiles, colors, blank, default_color, blocks, origin):
+    out = bytearray()
+    for x, y, w, h in blocks:
+        if not (0 < w < 256 and 0 < h < 256):
+            raise ToolError('block %dx%d is out of range' % (w, h))
+        sx, sy = x + origin[0], y + origin[1]
+        if not (0 <= sx < 256 and 0 <= sy < 256):
+            raise ToolError('block position %d,%d is out of range' % (sx, sy))
+        t, c = bytearray(), bytearray()
+        for r in range(y, y + h):
+            for col in range(x, x + w):
+                inside = 0 <= r < len(tiles) and 0 <= col < len(tiles[r])
+                t.append(tiles[r][col] if inside else blank)
+                c.append(colors[r][col] if inside else default_color)
+        out += bytes((w, h, sx, sy)) + rle_encode(t) + rle_encode(c)
+    out.append(0)
+    return bytes(out)
+
+
+def pair(text, count):
+    values = [int(v, 0) for v in text.split(',')]
+    if len(values) != count:
+        raise argparse.ArgumentTypeError('expected %d comma separated numbers' % count)
+    return values
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Compiles a text or PNG screen mockup into a BlueVGA drawLayout() array')
+    ap.add_argument('mockup', help='text mockup or PNG image')
+    ap.add_argument('-n', '--name', help='C array name (default: mockup file name)')
+    ap.add_argument('-o', '--output', help='output header (default: stdout)')
+    ap.add_argument('--font', help='font header for PNG mockups, as file.h or file.h:ARRAY_NAME')
+    ap.add_argument('--font-first', type=lambda s: int(s, 0), default=0,
+                    help='tile index of the first glyph of the font array (default 0)')
+    ap.add_argument('--default', default='WHITE on BLACK', help="colors of blank tiles (default 'WHITE on BLACK')")
+    ap.add_argument('--at', type=lambda s: pair(s, 2), default=[0, 0], help='x,y screen tile of the mockup top left corner')
+    ap.add_argument('--rect', type=lambda s: pair(s, 4), help='x,y,w,h single block to emit, in screen tiles')
+    ap.add_argument('--full', action='store_true', help='emit the whole mockup as a single block')
+    args = ap.parse_args()
+
+    try:
+        default_color = parse_colors(args.default)
+        if args.mockup.lower().endswith('.png'):
+            if not args.font:
+                raise ToolError('PNG mockups need --font')
+            tiles, colors, blank = read_png_mockup(args.mockup, args.font, args.font_first, default_color)
+        else:
+            tiles, colors, blank = read_text_mockup(args.mockup, default_color)
+        blocks = make_blocks(tiles, colors, blank, default_color, args.at, args.rect, args.full)
+        layout = build_layout(tiles, colors, blank, default_color, blocks, args.at)
+    except (ToolError, OSError) as e:
+        sys.exit('layout_compiler: %s' % e)
+
+    name = args.name or os.path.splitext(os.path.basename(args.mockup))[0]
+    cells = sum(w * h for _, _, w, h in blocks)
+    comment = '%s - %d block(s), %d tiles, %d bytes (%d bytes as raw tiles + colors)' % (
+        os.path.basename(args.mockup), len(blocks), cells, len(layout), cells * 2)
+    text = c_header(name.upper() + '_LAYOUT_H', c_array(name, layout, comment), os.path.basename(sys.argv[0]))
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write(comment + '\n')
+
+
+if __name__ == '__main__':
+    main()